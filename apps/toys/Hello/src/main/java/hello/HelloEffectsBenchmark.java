@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package hello;
+
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Node;
+import javafx.scene.Scene;
+import javafx.scene.SnapshotParameters;
+import javafx.scene.effect.BoxBlur;
+import javafx.scene.effect.DropShadow;
+import javafx.scene.effect.Effect;
+import javafx.scene.effect.GaussianBlur;
+import javafx.scene.effect.InnerShadow;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.shape.Rectangle;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+import javafx.stage.Stage;
+
+/**
+ * Times the software effect peers by repeatedly snapshotting nodes with
+ * blur and shadow effects. Run it once per kernel variant and compare the
+ * numbers, e.g.:
+ *
+ * <pre>
+ * -Dprism.order=sw -Ddecora.verbose=true -Ddecora.simd.kernels=scalar
+ * -Dprism.order=sw -Ddecora.verbose=true -Ddecora.simd.kernels=sse4.1
+ * -Dprism.order=sw -Ddecora.verbose=true -Ddecora.simd.kernels=avx2
+ * -Dprism.order=sw -Ddecora.simd=false    (the Java peers)
+ * </pre>
+ */
+public class HelloEffectsBenchmark extends Application {
+
+    private static final int WARMUP = 50;
+    private static final int ITERATIONS = 200;
+    private static final int SIZE = 512;
+
+    private final Effect[] effects = {
+        new BoxBlur(15, 15, 3),
+        new GaussianBlur(30),
+        new DropShadow(30, 10, 10, Color.BLACK),
+        new DropShadow(30, 10, 10, Color.web("#3050c0")),
+        new InnerShadow(20, Color.DARKRED),
+    };
+
+    private final Group content = new Group();
+    private final SnapshotParameters params = new SnapshotParameters();
+    private final WritableImage image = new WritableImage(SIZE + 100, SIZE + 100);
+
+    private int effect = 0;
+    private int iteration = 0;
+    private long start;
+
+    @Override public void start(Stage stage) {
+        Rectangle rect = new Rectangle(50, 50, SIZE - 100, SIZE - 100);
+        rect.setArcWidth(60);
+        rect.setArcHeight(60);
+        rect.setFill(Color.web("#20a060"));
+        Text text = new Text(80, SIZE / 2, "Decora");
+        text.setFont(Font.font(SIZE / 5));
+        text.setFill(Color.web("#e0e040"));
+        content.getChildren().addAll(rect, text);
+        params.setFill(Color.TRANSPARENT);
+
+        stage.setTitle("Effects Benchmark");
+        stage.setScene(new Scene(new Group(new Rectangle(200, 50, Color.WHITE))));
+        stage.show();
+
+        // Snapshot once per pulse so the effect work is all that is timed
+        new AnimationTimer() {
+            @Override public void handle(long now) {
+                if (step()) {
+                    stop();
+                    Platform.exit();
+                }
+            }
+        }.start();
+    }
+
+    private boolean step() {
+        if (iteration == 0) {
+            content.setEffect(effects[effect]);
+        }
+        if (iteration == WARMUP) {
+            start = System.nanoTime();
+        }
+        content.snapshot(params, image);
+        if (++iteration < WARMUP + ITERATIONS) {
+            return false;
+        }
+        double ms = (System.nanoTime() - start) / 1e6 / ITERATIONS;
+        System.out.printf("%-40s %8.3f ms/snapshot%n", describe(effects[effect]), ms);
+        iteration = 0;
+        return ++effect == effects.length;
+    }
+
+    private static String describe(Effect effect) {
+        if (effect instanceof BoxBlur b) {
+            return "BoxBlur " + b.getWidth() + "x" + b.getHeight() + " x" + b.getIterations();
+        } else if (effect instanceof GaussianBlur g) {
+            return "GaussianBlur " + g.getRadius();
+        } else if (effect instanceof DropShadow d) {
+            return "DropShadow " + d.getRadius() + " " + d.getColor();
+        } else if (effect instanceof InnerShadow s) {
+            return "InnerShadow " + s.getRadius() + " " + s.getColor();
+        }
+        return effect.toString();
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package hello;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+import netscape.javascript.JSObject;
+
+/**
+ * Times calls from JavaScript to the methods of a Java object bound with
+ * JSObject.setMember, one loop per parameter type. The first calls resolve
+ * the class and method metadata, so each loop is warmed up before it is
+ * timed. Several bound instances of the same class are called in turn, e.g.:
+ *
+ * <pre>
+ * java hello.HelloWebBridgeBenchmark
+ * java hello.HelloWebBridgeBenchmark 1000000
+ * </pre>
+ */
+public class HelloWebBridgeBenchmark extends Application {
+
+    private static final int WARMUP = 10000;
+    private static final int INSTANCES = 4;
+
+    private static final String[] CALLS = {
+        "addInt(i)",
+        "addDouble(i + 0.5)",
+        "addString('s' + (i & 7))",
+        "addBoolean((i & 1) == 0)",
+        "addAll(i, i + 0.5, 's', true)",
+    };
+
+    public static class Sink {
+        private long ints;
+        private double doubles;
+        private long chars;
+        private long trues;
+
+        public void addInt(int value) {
+            ints += value;
+        }
+
+        public void addDouble(double value) {
+            doubles += value;
+        }
+
+        public void addString(String value) {
+            chars += value.length();
+        }
+
+        public void addBoolean(boolean value) {
+            if (value) {
+                trues++;
+            }
+        }
+
+        public void addAll(int i, double d, String s, boolean b) {
+            addInt(i);
+            addDouble(d);
+            addString(s);
+            addBoolean(b);
+        }
+
+        @Override public String toString() {
+            return ints + " " + doubles + " " + chars + " " + trues;
+        }
+    }
+
+    private int iterations = 200000;
+
+    @Override public void start(Stage stage) {
+        if (!getParameters().getUnnamed().isEmpty()) {
+            iterations = Integer.parseInt(getParameters().getUnnamed().get(0));
+        }
+
+        WebView view = new WebView();
+        WebEngine engine = view.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, oldState, newState) -> {
+            if (newState == Worker.State.SUCCEEDED) {
+                JSObject window = (JSObject) engine.executeScript("window");
+                for (int i = 0; i < INSTANCES; i++) {
+                    window.setMember("sink" + i, new Sink());
+                }
+                // Let the window show before timing
+                Platform.runLater(() -> {
+                    run(engine);
+                    Platform.exit();
+                });
+            }
+        });
+        engine.loadContent("<html><body>Web Bridge Benchmark</body></html>");
+
+        stage.setTitle("Web Bridge Benchmark");
+        stage.setScene(new Scene(view, 300, 100));
+        stage.show();
+    }
+
+    private void run(WebEngine engine) {
+        engine.executeScript("var sinks = [];"
+                + "for (var i = 0; i < " + INSTANCES + "; i++) sinks.push(window['sink' + i]);");
+        for (String call : CALLS) {
+            String loop = "(function(n) {"
+                    + "  for (var i = 0; i < n; i++) {"
+                    + "    var sink = sinks[i % " + INSTANCES + "];"
+                    + "    sink." + call + ";"
+                    + "  }"
+                    + "})";
+            engine.executeScript(loop + "(" + WARMUP + ")");
+            long start = System.nanoTime();
+            engine.executeScript(loop + "(" + iterations + ")");
+            double ns = (double) (System.nanoTime() - start) / iterations;
+            System.out.printf("%-32s %8.1f ns/call %10.0f calls/s%n", call, ns, 1e9 / ns);
+        }
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,8 @@ public abstract class Pixels {
     private final float scalex;
     private final float scaley;
 
+    private volatile int[] dirtyRects;
+
     protected Pixels(final int width, final int height, final ByteBuffer pixels) {
         this(width, height, pixels, 1.0f, 1.0f);
     }
@@ -208,6 +210,27 @@ public abstract class Pixels {
         }
     }
 
+    /**
+     * Sets the areas that changed since the previously uploaded image, as
+     * x, y, width, height quadruples in pixels. A null value means the whole
+     * image has to be presented.
+     *
+     * @param rects the changed areas, or null
+     */
+    public final void setDirtyRects(int[] rects) {
+        this.dirtyRects = rects;
+    }
+
+    /**
+     * Returns the areas that changed since the previously uploaded image.
+     *
+     * @return the changed areas as x, y, width, height quadruples, or null if
+     * the whole image has to be presented
+     */
+    public final int[] getDirtyRects() {
+        return this.dirtyRects;
+    }
+
     /*
      * Return a copy of pixels as bytes.
      */
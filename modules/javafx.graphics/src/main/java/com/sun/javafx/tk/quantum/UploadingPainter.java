@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -175,6 +175,10 @@ final class UploadingPainter extends ViewPainter {
             }
 
             if (pix != null) {
+                // Only the painted areas have to be presented, unless the
+                // image was resolved or scaled after rendering.
+                pix.setDirtyRects(rtt == rttexture ? paintedRects : null);
+
                 /* transparent pixels created and ready for upload */
                 // Copy references, which are volatile, used by upload. Thus
                 // ensure they still exist once event queue is consumed.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.javafx.tk.quantum;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.concurrent.locks.ReentrantLock;
 import com.sun.javafx.geom.DirtyRegionContainer;
@@ -86,6 +87,12 @@ abstract class ViewPainter implements Runnable {
     protected ResourceFactory factory;
     protected boolean freshBackBuffer;
 
+    /**
+     * Device pixel bounds of the areas painted by the last call to paintImpl,
+     * as x, y, width, height quadruples, or null if the whole view was painted.
+     */
+    protected int[] paintedRects;
+
     private int width;
     private int height;
 
@@ -163,6 +170,8 @@ abstract class ViewPainter implements Runnable {
     }
 
     protected void paintImpl(final Graphics backBufferGraphics) {
+        paintedRects = null;
+
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
@@ -303,7 +312,10 @@ abstract class ViewPainter implements Runnable {
                 PulseLogger.addMessage(s.toString());
             }
 
-            // Paint each dirty region
+            // Paint each dirty region, remembering where we painted unless
+            // debug overlays are drawn over the whole scene below
+            int[] rects = showDirtyOpts ? null : new int[dirtyRegionSize * 4];
+            int rectCount = 0;
             for (int i = 0; i < dirtyRegionSize; ++i) {
                 final RectBounds dirtyRegion = dirtyRegionContainer.getDirtyRegion(i);
                 // TODO it should be impossible to have ever created a dirty region that was empty...
@@ -320,8 +332,17 @@ abstract class ViewPainter implements Runnable {
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
+                    if (rects != null) {
+                        rects[rectCount++] = dirtyRect.x;
+                        rects[rectCount++] = dirtyRect.y;
+                        rects[rectCount++] = dirtyRect.width;
+                        rects[rectCount++] = dirtyRect.height;
+                    }
                 }
             }
+            if (rectCount > 0) {
+                paintedRects = Arrays.copyOf(rects, rectCount);
+            }
         } else {
             // There are no dirty regions, so just paint everything
             g.setHasPreCullingBits(false);
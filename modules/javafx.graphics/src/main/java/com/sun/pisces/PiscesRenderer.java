@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,6 +93,23 @@ public final class PiscesRenderer {
 
     private native void initialize();
 
+    /**
+     * Sets the number of threads, including the calling one, that large
+     * fills are split across. Each thread fills its own band of rows, so the
+     * output is the same as with a single thread. Worker threads are started
+     * as needed and keep running when the count is lowered again.
+     *
+     * @param threads number of threads, 1 to fill on the calling thread only
+     */
+    public static void setThreadCount(int threads) {
+        if (threads < 1) {
+            throw new IllegalArgumentException("Thread count must be at least 1");
+        }
+        setThreadCountImpl(threads);
+    }
+
+    private static native void setThreadCountImpl(int threads);
+
     /**
      * Sets the current paint color.
      *
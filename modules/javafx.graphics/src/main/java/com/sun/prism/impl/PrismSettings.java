@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,7 @@ public final class PrismSettings {
     public static final boolean forceUploadingPainter;
     public static final boolean forceAlphaTestShader;
     public static final boolean forceNonAntialiasedShape;
+    public static final int swThreads;
 
     public static enum RasterizerType {
         DoubleMarlin("Double Precision Marlin Rasterizer");
@@ -356,6 +357,21 @@ public final class PrismSettings {
         // Force non anti-aliasing (not smooth) shape rendering
         forceNonAntialiasedShape = getBoolean(systemProperties, "prism.forceNonAntialiasedShape", false);
 
+        /*
+         * Number of threads the sw pipeline uses to fill large rectangles,
+         * images, gradients and masks, split into horizontal bands.
+         * Default is 1 (render thread only); a value <= 0 uses one thread
+         * per available processor.
+         */
+        int threads = getInt(systemProperties, "prism.sw.threads", 1,
+                             "Try -Dprism.sw.threads=<number>");
+        if (threads <= 0) {
+            threads = Runtime.getRuntime().availableProcessors();
+        }
+        swThreads = Utils.clamp(1, threads, 32);
+        if (verbose && swThreads > 1) {
+            System.out.println("Prism SW pipeline threads: " + swThreads);
+        }
     }
 
     private static int parseInt(String s, int dflt, int trueDflt,
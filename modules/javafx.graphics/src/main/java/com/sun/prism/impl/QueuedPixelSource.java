@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.prism.PixelSource;
 import java.lang.ref.WeakReference;
 import java.nio.IntBuffer;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 /**
@@ -59,11 +60,16 @@ import java.util.List;
  * {@code Pixels} objects in play.
  */
 public class QueuedPixelSource implements PixelSource {
+    // Beyond this many merged dirty rectangles the whole image is presented
+    private static final int MAX_DIRTY_RECTS = 32;
+
     private volatile Pixels beingConsumed;
     private volatile Pixels enqueued;
     private final List<WeakReference<Pixels>> saved =
          new ArrayList<>(3);
     private final boolean useDirectBuffers;
+    // Set when a delivery was skipped, the next one has to be presented whole
+    private boolean damageLost;
 
     public QueuedPixelSource(boolean useDirectBuffers) {
         this.useDirectBuffers = useDirectBuffers;
@@ -94,6 +100,9 @@ public class QueuedPixelSource implements PixelSource {
         if (beingConsumed != null) {
             throw new IllegalStateException("cannot skip while processing: "+beingConsumed);
         }
+        if (enqueued != null) {
+            damageLost = true;
+        }
         enqueued = null;
     }
 
@@ -166,10 +175,27 @@ public class QueuedPixelSource implements PixelSource {
      * Place the indicated {@code Pixels} object into the enqueued state,
      * replacing any other objects that are currently enqueued but not yet
      * being used by the consumer.
+     * Dirty rectangles of a replaced object are added to the new one, since
+     * they were never presented.
      *
      * @param pixels the {@code Pixels} object to be enqueued
      */
     public synchronized void enqueuePixels(Pixels pixels) {
+        if (damageLost) {
+            pixels.setDirtyRects(null);
+            damageLost = false;
+        } else if (enqueued != null && enqueued != pixels) {
+            pixels.setDirtyRects(mergeDirtyRects(enqueued.getDirtyRects(), pixels.getDirtyRects()));
+        }
         enqueued = pixels;
     }
+
+    private static int[] mergeDirtyRects(int[] r1, int[] r2) {
+        if (r1 == null || r2 == null || (r1.length + r2.length) / 4 > MAX_DIRTY_RECTS) {
+            return null;
+        }
+        int[] merged = Arrays.copyOf(r1, r1.length + r2.length);
+        System.arraycopy(r2, 0, merged, r1.length, r2.length);
+        return merged;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,8 +34,21 @@ public class SSERendererDelegate implements RendererDelegate {
 
     public static native boolean isSupported();
 
+    /**
+     * Chooses the native kernels used by the peers: the best instruction
+     * set supported by the processor, capped at {@code preferred}
+     * ("avx2", "sse4.1", "neon" or "scalar") if it names one.
+     *
+     * @return the name of the kernels in use
+     */
+    static native String selectKernels(String preferred);
+
     static {
         NativeLibLoader.loadLibrary("decora_sse");
+        String kernels = selectKernels(System.getProperty("decora.simd.kernels"));
+        if (Boolean.getBoolean("decora.verbose")) {
+            System.out.println("Decora SIMD kernels: " + kernels);
+        }
     }
 
     public SSERendererDelegate() {
@@ -0,0 +1,1199 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "SSEKernels.h"
+#include "com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define DECORA_KERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_SSE41
+#define TARGET_AVX2
+#else
+/*
+ * The library is built for the SSE2 baseline, so the wider kernels are
+ * compiled for their own instruction set and only called after the
+ * processor has been checked for it.
+ */
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define DECORA_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+#define cmin 1.0f
+#define cmax (255.0f - 1.0f/32.0f)
+
+/*
+ * Scalar kernels, the loops the peers have always used.
+ */
+
+static void boxBlurHorizontalScalar(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                    jint *srcPixels, jint srcw, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    jint kscale = 0x7fffffff / (hsize * 255);
+    jint srcoff = 0;
+    jint dstoff = 0;
+    for (jint y = 0; y < dsth; y++) {
+        jint suma = 0;
+        jint sumr = 0;
+        jint sumg = 0;
+        jint sumb = 0;
+        for (jint x = 0; x < dstw; x++) {
+            jint rgb;
+            // Un-accumulate the data for col-hsize location into the sums.
+            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            sumr -= (rgb >> 16) & 0xff;
+            sumg -= (rgb >>  8) & 0xff;
+            sumb -= (rgb      ) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
+            suma += (rgb >> 24) & 0xff;
+            sumr += (rgb >> 16) & 0xff;
+            sumg += (rgb >>  8) & 0xff;
+            sumb += (rgb      ) & 0xff;
+            dstPixels[dstoff + x] =
+                (((suma * kscale) >> 23) << 24) +
+                (((sumr * kscale) >> 23) << 16) +
+                (((sumg * kscale) >> 23) <<  8) +
+                (((sumb * kscale) >> 23)      );
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void boxBlurVerticalScalar(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan)
+{
+    jint vsize = dsth - srch + 1;
+    jint kscale = 0x7fffffff / (vsize * 255);
+    jint voff = vsize * srcscan;
+    for (jint x = 0; x < dstw; x++) {
+        jint suma = 0;
+        jint sumr = 0;
+        jint sumg = 0;
+        jint sumb = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            sumr -= (rgb >> 16) & 0xff;
+            sumg -= (rgb >>  8) & 0xff;
+            sumb -= (rgb      ) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            sumr += (rgb >> 16) & 0xff;
+            sumg += (rgb >>  8) & 0xff;
+            sumb += (rgb      ) & 0xff;
+            dstPixels[dstoff] =
+                (((suma * kscale) >> 23) << 24) +
+                (((sumr * kscale) >> 23) << 16) +
+                (((sumg * kscale) >> 23) <<  8) +
+                (((sumb * kscale) >> 23)      );
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+// Clamp, scale and convert an alpha sum into a color.
+static inline jint shadowPixelBlack(jint suma, jint amin, jint amax, jint kscale)
+{
+    return ((suma < amin) ? 0
+            : ((suma >= amax) ? 0xff000000
+               : (((suma * kscale) >> 23) << 24)));
+}
+
+static inline jint shadowPixel(jint suma, jint amin, jint amax, const jint *kscales,
+                               jint shadowRGB)
+{
+    return ((suma < amin) ? 0
+            : ((suma >= amax) ? shadowRGB
+               : ((((suma * kscales[0]) >> 23) << 24) |
+                  (((suma * kscales[1]) >> 23) << 16) |
+                  (((suma * kscales[2]) >> 23) <<  8) |
+                  (((suma * kscales[3]) >> 23)      ))));
+}
+
+static void boxShadowHorizontalBlackScalar(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                           jint *srcPixels, jint srcw, jint srcscan,
+                                           jint amin, jint amax, jint kscale)
+{
+    jint hsize = dstw - srcw + 1;
+    jint srcoff = 0;
+    jint dstoff = 0;
+    for (jint y = 0; y < dsth; y++) {
+        jint suma = 0;
+        for (jint x = 0; x < dstw; x++) {
+            jint rgb;
+            // Un-accumulate the data for col-hsize location into the sums.
+            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
+            suma += (rgb >> 24) & 0xff;
+            dstPixels[dstoff + x] = shadowPixelBlack(suma, amin, amax, kscale);
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void boxShadowVerticalBlackScalar(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                         jint *srcPixels, jint srch, jint srcscan,
+                                         jint amin, jint amax, jint kscale)
+{
+    jint vsize = dsth - srch + 1;
+    jint voff = vsize * srcscan;
+    for (jint x = 0; x < dstw; x++) {
+        jint suma = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this row location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            dstPixels[dstoff] = shadowPixelBlack(suma, amin, amax, kscale);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+static void boxShadowVerticalScalar(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                    jint *srcPixels, jint srch, jint srcscan,
+                                    jint amin, jint amax, const jint *kscales,
+                                    jint shadowRGB)
+{
+    jint vsize = dsth - srch + 1;
+    jint voff = vsize * srcscan;
+    for (jint x = 0; x < dstw; x++) {
+        jint suma = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this row location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            dstPixels[dstoff] = shadowPixel(suma, amin, amax, kscales, shadowRGB);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+static void linearConvolveHVScalar(jint *dstPixels, jint dstcols, jint dstrows,
+                                   jint dcolinc, jint drowinc,
+                                   jint *srcPixels, jint srccols,
+                                   jint scolinc, jint srowinc,
+                                   const jfloat *kvals, jint kernelSize)
+{
+    // cvals stores the component values from the surrounding K pixels
+    // from x-r to x+r
+    jfloat cvals[128*4];
+    jint dstrow = 0;
+    jint srcrow = 0;
+    for (jint r = 0; r < dstrows; r++) {
+        jint dstoff = dstrow;
+        jint srcoff = srcrow;
+        // Must clear out the array at the start of every line
+        // Might be able to rely on the fact that the previous line must
+        // have run out of data towards the end of the scan line, though.
+        for (jint i = 0; i < kernelSize*4; i++) {
+            cvals[i] = 0.0f;
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            // Load the data for this x location into the array.
+            jint i = (kernelSize - koff) * 4;
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            cvals[i+0] = (jfloat) ((rgb >> 24) & 0xff);
+            cvals[i+1] = (jfloat) ((rgb >> 16) & 0xff);
+            cvals[i+2] = (jfloat) ((rgb >>  8) & 0xff);
+            cvals[i+3] = (jfloat) ((rgb      ) & 0xff);
+            // Bump the koff to the next spot to align the coefficients.
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            jfloat suma = 0.0f;
+            jfloat sumr = 0.0f;
+            jfloat sumg = 0.0f;
+            jfloat sumb = 0.0f;
+            for (i = 0; i < kernelSize*4; i += 4) {
+                jfloat factor = kvals[koff + (i>>2)];
+                suma += cvals[i+0] * factor;
+                sumr += cvals[i+1] * factor;
+                sumg += cvals[i+2] * factor;
+                sumb += cvals[i+3] * factor;
+            }
+            dstPixels[dstoff] =
+                (((suma < cmin) ? 0 : ((suma > cmax) ? 255 : ((jint) suma))) << 24) +
+                (((sumr < cmin) ? 0 : ((sumr > cmax) ? 255 : ((jint) sumr))) << 16) +
+                (((sumg < cmin) ? 0 : ((sumg > cmax) ? 255 : ((jint) sumg))) <<  8) +
+                (((sumb < cmin) ? 0 : ((sumb > cmax) ? 255 : ((jint) sumb)))      );
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+}
+
+static const DecoraKernels scalarKernels = {
+    "scalar",
+    boxBlurHorizontalScalar,
+    boxBlurVerticalScalar,
+    boxShadowHorizontalBlackScalar,
+    boxShadowVerticalBlackScalar,
+    boxShadowVerticalScalar,
+    linearConvolveHVScalar,
+};
+
+/*
+ * The vector kernels keep the sliding sums of the scalar loops but hold
+ * them in vector lanes: one lane per color channel for the blurs and the
+ * convolution, one lane per row or column for the alpha-only shadows.
+ * The vertical passes walk the image a row at a time with a buffer of
+ * per-column sums instead of a column at a time, which keeps the loads
+ * sequential; they fall back to the scalar loop if that buffer cannot be
+ * allocated.
+ */
+
+#ifdef DECORA_KERNELS_X86
+
+static inline TARGET_SSE41 __m128i unpackPixelSSE41(jint rgb)
+{
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(rgb));
+}
+
+static inline TARGET_SSE41 jint packPixelSSE41(__m128i v)
+{
+    v = _mm_packus_epi32(v, v);
+    v = _mm_packus_epi16(v, v);
+    return _mm_cvtsi128_si32(v);
+}
+
+static inline TARGET_SSE41 __m128i shadowPixelsSSE41(__m128i suma,
+                                                    __m128i amin, __m128i amax,
+                                                    __m128i scaled, __m128i opaque)
+{
+    __m128i v = _mm_blendv_epi8(opaque, scaled, _mm_cmplt_epi32(suma, amax));
+    return _mm_andnot_si128(_mm_cmplt_epi32(suma, amin), v);
+}
+
+static inline TARGET_SSE41 __m128i scaleAlphaSSE41(__m128i suma, __m128i kscale, int shift)
+{
+    return _mm_slli_epi32(_mm_srai_epi32(_mm_mullo_epi32(suma, kscale), 23), shift);
+}
+
+static TARGET_SSE41 void boxBlurHorizontalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                jint *srcPixels, jint srcw, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (hsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *srcRow = srcPixels + y * srcscan;
+        jint *dstRow = dstPixels + y * dstscan;
+        __m128i sum = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = _mm_sub_epi32(sum, unpackPixelSSE41(srcRow[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = _mm_add_epi32(sum, unpackPixelSSE41(srcRow[x]));
+            }
+            dstRow[x] = packPixelSSE41(_mm_srai_epi32(_mm_mullo_epi32(sum, kscale), 23));
+        }
+    }
+}
+
+static TARGET_SSE41 void boxBlurVerticalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                              jint *srcPixels, jint srch, jint srcscan)
+{
+    jint *sums = (jint *) calloc((size_t) dstw * 4, sizeof(jint));
+    if (sums == NULL) {
+        boxBlurVerticalScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (vsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        for (jint x = 0; x < dstw; x++) {
+            __m128i *psum = (__m128i *) (sums + x * 4);
+            __m128i sum = _mm_loadu_si128(psum);
+            if (subRow != NULL) {
+                sum = _mm_sub_epi32(sum, unpackPixelSSE41(subRow[x]));
+            }
+            if (addRow != NULL) {
+                sum = _mm_add_epi32(sum, unpackPixelSSE41(addRow[x]));
+            }
+            _mm_storeu_si128(psum, sum);
+            dstRow[x] = packPixelSSE41(_mm_srai_epi32(_mm_mullo_epi32(sum, kscale), 23));
+        }
+    }
+    free(sums);
+}
+
+static inline TARGET_SSE41 __m128i loadAlphaColumnSSE41(jint *src, jint scan)
+{
+    __m128i v = _mm_setr_epi32(src[0], src[scan], src[2 * scan], src[3 * scan]);
+    return _mm_srli_epi32(v, 24);
+}
+
+static TARGET_SSE41 void boxShadowHorizontalBlackSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                       jint *srcPixels, jint srcw, jint srcscan,
+                                                       jint amin, jint amax, jint kscale)
+{
+    jint hsize = dstw - srcw + 1;
+    __m128i vamin = _mm_set1_epi32(amin);
+    __m128i vamax = _mm_set1_epi32(amax);
+    __m128i vkscale = _mm_set1_epi32(kscale);
+    __m128i opaque = _mm_set1_epi32((int) 0xff000000);
+    jint y = 0;
+    // Four rows at a time, one per lane.
+    for (; y + 4 <= dsth; y += 4) {
+        jint *srcRow = srcPixels + y * srcscan;
+        jint *dstRow = dstPixels + y * dstscan;
+        __m128i sum = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = _mm_sub_epi32(sum, loadAlphaColumnSSE41(srcRow + x - hsize, srcscan));
+            }
+            if (x < srcw) {
+                sum = _mm_add_epi32(sum, loadAlphaColumnSSE41(srcRow + x, srcscan));
+            }
+            __m128i v = shadowPixelsSSE41(sum, vamin, vamax,
+                                          scaleAlphaSSE41(sum, vkscale, 24), opaque);
+            dstRow[x] = _mm_cvtsi128_si32(v);
+            dstRow[x + dstscan] = _mm_extract_epi32(v, 1);
+            dstRow[x + 2 * dstscan] = _mm_extract_epi32(v, 2);
+            dstRow[x + 3 * dstscan] = _mm_extract_epi32(v, 3);
+        }
+    }
+    if (y < dsth) {
+        boxShadowHorizontalBlackScalar(dstPixels + y * dstscan, dstw, dsth - y, dstscan,
+                                       srcPixels + y * srcscan, srcw, srcscan,
+                                       amin, amax, kscale);
+    }
+}
+
+static TARGET_SSE41 void boxShadowVerticalBlackSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                     jint *srcPixels, jint srch, jint srcscan,
+                                                     jint amin, jint amax, jint kscale)
+{
+    jint *sums = (jint *) calloc((size_t) dstw, sizeof(jint));
+    if (sums == NULL) {
+        boxShadowVerticalBlackScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan,
+                                     amin, amax, kscale);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    __m128i vamin = _mm_set1_epi32(amin);
+    __m128i vamax = _mm_set1_epi32(amax);
+    __m128i vkscale = _mm_set1_epi32(kscale);
+    __m128i opaque = _mm_set1_epi32((int) 0xff000000);
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        // Four columns at a time, one per lane.
+        for (; x + 4 <= dstw; x += 4) {
+            __m128i sum = _mm_loadu_si128((__m128i *) (sums + x));
+            if (subRow != NULL) {
+                sum = _mm_sub_epi32(sum, _mm_srli_epi32(_mm_loadu_si128((__m128i *) (subRow + x)), 24));
+            }
+            if (addRow != NULL) {
+                sum = _mm_add_epi32(sum, _mm_srli_epi32(_mm_loadu_si128((__m128i *) (addRow + x)), 24));
+            }
+            _mm_storeu_si128((__m128i *) (sums + x), sum);
+            _mm_storeu_si128((__m128i *) (dstRow + x),
+                             shadowPixelsSSE41(sum, vamin, vamax,
+                                               scaleAlphaSSE41(sum, vkscale, 24), opaque));
+        }
+        for (; x < dstw; x++) {
+            jint suma = sums[x];
+            if (subRow != NULL) suma -= (subRow[x] >> 24) & 0xff;
+            if (addRow != NULL) suma += (addRow[x] >> 24) & 0xff;
+            sums[x] = suma;
+            dstRow[x] = shadowPixelBlack(suma, amin, amax, kscale);
+        }
+    }
+    free(sums);
+}
+
+static TARGET_SSE41 void boxShadowVerticalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                jint *srcPixels, jint srch, jint srcscan,
+                                                jint amin, jint amax, const jint *kscales,
+                                                jint shadowRGB)
+{
+    jint *sums = (jint *) calloc((size_t) dstw, sizeof(jint));
+    if (sums == NULL) {
+        boxShadowVerticalScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan,
+                                amin, amax, kscales, shadowRGB);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    __m128i vamin = _mm_set1_epi32(amin);
+    __m128i vamax = _mm_set1_epi32(amax);
+    __m128i kscalea = _mm_set1_epi32(kscales[0]);
+    __m128i kscaler = _mm_set1_epi32(kscales[1]);
+    __m128i kscaleg = _mm_set1_epi32(kscales[2]);
+    __m128i kscaleb = _mm_set1_epi32(kscales[3]);
+    __m128i opaque = _mm_set1_epi32(shadowRGB);
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        for (; x + 4 <= dstw; x += 4) {
+            __m128i sum = _mm_loadu_si128((__m128i *) (sums + x));
+            if (subRow != NULL) {
+                sum = _mm_sub_epi32(sum, _mm_srli_epi32(_mm_loadu_si128((__m128i *) (subRow + x)), 24));
+            }
+            if (addRow != NULL) {
+                sum = _mm_add_epi32(sum, _mm_srli_epi32(_mm_loadu_si128((__m128i *) (addRow + x)), 24));
+            }
+            _mm_storeu_si128((__m128i *) (sums + x), sum);
+            __m128i scaled = _mm_or_si128(
+                _mm_or_si128(scaleAlphaSSE41(sum, kscalea, 24), scaleAlphaSSE41(sum, kscaler, 16)),
+                _mm_or_si128(scaleAlphaSSE41(sum, kscaleg, 8), scaleAlphaSSE41(sum, kscaleb, 0)));
+            _mm_storeu_si128((__m128i *) (dstRow + x),
+                             shadowPixelsSSE41(sum, vamin, vamax, scaled, opaque));
+        }
+        for (; x < dstw; x++) {
+            jint suma = sums[x];
+            if (subRow != NULL) suma -= (subRow[x] >> 24) & 0xff;
+            if (addRow != NULL) suma += (addRow[x] >> 24) & 0xff;
+            sums[x] = suma;
+            dstRow[x] = shadowPixel(suma, amin, amax, kscales, shadowRGB);
+        }
+    }
+    free(sums);
+}
+
+static TARGET_SSE41 void linearConvolveHVSSE41(jint *dstPixels, jint dstcols, jint dstrows,
+                                               jint dcolinc, jint drowinc,
+                                               jint *srcPixels, jint srccols,
+                                               jint scolinc, jint srowinc,
+                                               const jfloat *kvals, jint kernelSize)
+{
+    // Same ring of the last K pixels as the scalar loop, one vector per
+    // pixel, accumulated in the same order with separate multiplies and
+    // adds so that the sums round the same way.
+    __m128 cvals[128];
+    __m128 vcmin = _mm_set1_ps(cmin);
+    __m128 vcmax = _mm_set1_ps(cmax);
+    __m128i v255 = _mm_set1_epi32(255);
+    jint dstrow = 0;
+    jint srcrow = 0;
+    for (jint r = 0; r < dstrows; r++) {
+        jint dstoff = dstrow;
+        jint srcoff = srcrow;
+        for (jint i = 0; i < kernelSize; i++) {
+            cvals[i] = _mm_setzero_ps();
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            cvals[kernelSize - koff] = _mm_cvtepi32_ps(unpackPixelSSE41(rgb));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            __m128 sum = _mm_setzero_ps();
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(cvals[i], _mm_set1_ps(kvals[koff + i])));
+            }
+            __m128i v = _mm_cvttps_epi32(sum);
+            v = _mm_blendv_epi8(v, v255, _mm_castps_si128(_mm_cmpgt_ps(sum, vcmax)));
+            v = _mm_andnot_si128(_mm_castps_si128(_mm_cmplt_ps(sum, vcmin)), v);
+            dstPixels[dstoff] = packPixelSSE41(v);
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+}
+
+static const DecoraKernels sse41Kernels = {
+    "sse4.1",
+    boxBlurHorizontalSSE41,
+    boxBlurVerticalSSE41,
+    boxShadowHorizontalBlackSSE41,
+    boxShadowVerticalBlackSSE41,
+    boxShadowVerticalSSE41,
+    linearConvolveHVSSE41,
+};
+
+static inline TARGET_AVX2 __m256i unpackPixelPairAVX2(jint rgb0, jint rgb1)
+{
+    return _mm256_cvtepu8_epi32(_mm_unpacklo_epi32(_mm_cvtsi32_si128(rgb0),
+                                                   _mm_cvtsi32_si128(rgb1)));
+}
+
+static inline TARGET_AVX2 void storePixelPairAVX2(__m256i v, jint *dst0, jint *dst1)
+{
+    // The packs work within each 128-bit half, leaving one pixel in the
+    // low dword of each half.
+    v = _mm256_packus_epi32(v, v);
+    v = _mm256_packus_epi16(v, v);
+    *dst0 = _mm_cvtsi128_si32(_mm256_castsi256_si128(v));
+    *dst1 = _mm_cvtsi128_si32(_mm256_extracti128_si256(v, 1));
+}
+
+static inline TARGET_AVX2 __m256i shadowPixelsAVX2(__m256i suma,
+                                                  __m256i amin, __m256i amax,
+                                                  __m256i scaled, __m256i opaque)
+{
+    __m256i v = _mm256_blendv_epi8(opaque, scaled, _mm256_cmpgt_epi32(amax, suma));
+    return _mm256_andnot_si256(_mm256_cmpgt_epi32(amin, suma), v);
+}
+
+static inline TARGET_AVX2 __m256i scaleAlphaAVX2(__m256i suma, __m256i kscale, int shift)
+{
+    return _mm256_slli_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(suma, kscale), 23), shift);
+}
+
+static TARGET_AVX2 void boxBlurHorizontalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                              jint *srcPixels, jint srcw, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    __m256i kscale = _mm256_set1_epi32(0x7fffffff / (hsize * 255));
+    jint y = 0;
+    // Two rows at a time, four channels of each.
+    for (; y + 2 <= dsth; y += 2) {
+        jint *src0 = srcPixels + y * srcscan;
+        jint *src1 = src0 + srcscan;
+        jint *dst0 = dstPixels + y * dstscan;
+        jint *dst1 = dst0 + dstscan;
+        __m256i sum = _mm256_setzero_si256();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = _mm256_sub_epi32(sum, unpackPixelPairAVX2(src0[x - hsize], src1[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = _mm256_add_epi32(sum, unpackPixelPairAVX2(src0[x], src1[x]));
+            }
+            storePixelPairAVX2(_mm256_srai_epi32(_mm256_mullo_epi32(sum, kscale), 23),
+                               dst0 + x, dst1 + x);
+        }
+    }
+    if (y < dsth) {
+        boxBlurHorizontalSSE41(dstPixels + y * dstscan, dstw, dsth - y, dstscan,
+                               srcPixels + y * srcscan, srcw, srcscan);
+    }
+}
+
+static TARGET_AVX2 void boxBlurVerticalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                            jint *srcPixels, jint srch, jint srcscan)
+{
+    jint *sums = (jint *) calloc((size_t) dstw * 4, sizeof(jint));
+    if (sums == NULL) {
+        boxBlurVerticalScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    __m256i kscale = _mm256_set1_epi32(0x7fffffff / (vsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        // Two columns at a time, four channels of each.
+        for (; x + 2 <= dstw; x += 2) {
+            __m256i *psum = (__m256i *) (sums + x * 4);
+            __m256i sum = _mm256_loadu_si256(psum);
+            if (subRow != NULL) {
+                sum = _mm256_sub_epi32(sum,
+                    _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i *) (subRow + x))));
+            }
+            if (addRow != NULL) {
+                sum = _mm256_add_epi32(sum,
+                    _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i *) (addRow + x))));
+            }
+            _mm256_storeu_si256(psum, sum);
+            storePixelPairAVX2(_mm256_srai_epi32(_mm256_mullo_epi32(sum, kscale), 23),
+                               dstRow + x, dstRow + x + 1);
+        }
+        if (x < dstw) {
+            __m128i *psum = (__m128i *) (sums + x * 4);
+            __m128i sum = _mm_loadu_si128(psum);
+            if (subRow != NULL) {
+                sum = _mm_sub_epi32(sum, unpackPixelSSE41(subRow[x]));
+            }
+            if (addRow != NULL) {
+                sum = _mm_add_epi32(sum, unpackPixelSSE41(addRow[x]));
+            }
+            _mm_storeu_si128(psum, sum);
+            dstRow[x] = packPixelSSE41(_mm_srai_epi32(
+                _mm_mullo_epi32(sum, _mm256_castsi256_si128(kscale)), 23));
+        }
+    }
+    free(sums);
+}
+
+static TARGET_AVX2 void boxShadowHorizontalBlackAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                     jint *srcPixels, jint srcw, jint srcscan,
+                                                     jint amin, jint amax, jint kscale)
+{
+    jint hsize = dstw - srcw + 1;
+    __m256i vamin = _mm256_set1_epi32(amin);
+    __m256i vamax = _mm256_set1_epi32(amax);
+    __m256i vkscale = _mm256_set1_epi32(kscale);
+    __m256i opaque = _mm256_set1_epi32((int) 0xff000000);
+    jint out[8];
+    jint y = 0;
+    // Eight rows at a time, one per lane.
+    for (; y + 8 <= dsth; y += 8) {
+        jint *srcRow = srcPixels + y * srcscan;
+        jint *dstRow = dstPixels + y * dstscan;
+        __m256i sum = _mm256_setzero_si256();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                jint *s = srcRow + x - hsize;
+                sum = _mm256_sub_epi32(sum, _mm256_srli_epi32(_mm256_setr_epi32(
+                    s[0], s[srcscan], s[2 * srcscan], s[3 * srcscan],
+                    s[4 * srcscan], s[5 * srcscan], s[6 * srcscan], s[7 * srcscan]), 24));
+            }
+            if (x < srcw) {
+                jint *s = srcRow + x;
+                sum = _mm256_add_epi32(sum, _mm256_srli_epi32(_mm256_setr_epi32(
+                    s[0], s[srcscan], s[2 * srcscan], s[3 * srcscan],
+                    s[4 * srcscan], s[5 * srcscan], s[6 * srcscan], s[7 * srcscan]), 24));
+            }
+            _mm256_storeu_si256((__m256i *) out,
+                                shadowPixelsAVX2(sum, vamin, vamax,
+                                                 scaleAlphaAVX2(sum, vkscale, 24), opaque));
+            jint *d = dstRow + x;
+            for (int i = 0; i < 8; i++) {
+                d[i * dstscan] = out[i];
+            }
+        }
+    }
+    if (y < dsth) {
+        boxShadowHorizontalBlackSSE41(dstPixels + y * dstscan, dstw, dsth - y, dstscan,
+                                      srcPixels + y * srcscan, srcw, srcscan,
+                                      amin, amax, kscale);
+    }
+}
+
+static TARGET_AVX2 void boxShadowVerticalBlackAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                   jint *srcPixels, jint srch, jint srcscan,
+                                                   jint amin, jint amax, jint kscale)
+{
+    jint *sums = (jint *) calloc((size_t) dstw, sizeof(jint));
+    if (sums == NULL) {
+        boxShadowVerticalBlackScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan,
+                                     amin, amax, kscale);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    __m256i vamin = _mm256_set1_epi32(amin);
+    __m256i vamax = _mm256_set1_epi32(amax);
+    __m256i vkscale = _mm256_set1_epi32(kscale);
+    __m256i opaque = _mm256_set1_epi32((int) 0xff000000);
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        // Eight columns at a time, one per lane.
+        for (; x + 8 <= dstw; x += 8) {
+            __m256i sum = _mm256_loadu_si256((__m256i *) (sums + x));
+            if (subRow != NULL) {
+                sum = _mm256_sub_epi32(sum,
+                    _mm256_srli_epi32(_mm256_loadu_si256((__m256i *) (subRow + x)), 24));
+            }
+            if (addRow != NULL) {
+                sum = _mm256_add_epi32(sum,
+                    _mm256_srli_epi32(_mm256_loadu_si256((__m256i *) (addRow + x)), 24));
+            }
+            _mm256_storeu_si256((__m256i *) (sums + x), sum);
+            _mm256_storeu_si256((__m256i *) (dstRow + x),
+                                shadowPixelsAVX2(sum, vamin, vamax,
+                                                 scaleAlphaAVX2(sum, vkscale, 24), opaque));
+        }
+        for (; x < dstw; x++) {
+            jint suma = sums[x];
+            if (subRow != NULL) suma -= (subRow[x] >> 24) & 0xff;
+            if (addRow != NULL) suma += (addRow[x] >> 24) & 0xff;
+            sums[x] = suma;
+            dstRow[x] = shadowPixelBlack(suma, amin, amax, kscale);
+        }
+    }
+    free(sums);
+}
+
+static TARGET_AVX2 void boxShadowVerticalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                              jint *srcPixels, jint srch, jint srcscan,
+                                              jint amin, jint amax, const jint *kscales,
+                                              jint shadowRGB)
+{
+    jint *sums = (jint *) calloc((size_t) dstw, sizeof(jint));
+    if (sums == NULL) {
+        boxShadowVerticalScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan,
+                                amin, amax, kscales, shadowRGB);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    __m256i vamin = _mm256_set1_epi32(amin);
+    __m256i vamax = _mm256_set1_epi32(amax);
+    __m256i kscalea = _mm256_set1_epi32(kscales[0]);
+    __m256i kscaler = _mm256_set1_epi32(kscales[1]);
+    __m256i kscaleg = _mm256_set1_epi32(kscales[2]);
+    __m256i kscaleb = _mm256_set1_epi32(kscales[3]);
+    __m256i opaque = _mm256_set1_epi32(shadowRGB);
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        for (; x + 8 <= dstw; x += 8) {
+            __m256i sum = _mm256_loadu_si256((__m256i *) (sums + x));
+            if (subRow != NULL) {
+                sum = _mm256_sub_epi32(sum,
+                    _mm256_srli_epi32(_mm256_loadu_si256((__m256i *) (subRow + x)), 24));
+            }
+            if (addRow != NULL) {
+                sum = _mm256_add_epi32(sum,
+                    _mm256_srli_epi32(_mm256_loadu_si256((__m256i *) (addRow + x)), 24));
+            }
+            _mm256_storeu_si256((__m256i *) (sums + x), sum);
+            __m256i scaled = _mm256_or_si256(
+                _mm256_or_si256(scaleAlphaAVX2(sum, kscalea, 24), scaleAlphaAVX2(sum, kscaler, 16)),
+                _mm256_or_si256(scaleAlphaAVX2(sum, kscaleg, 8), scaleAlphaAVX2(sum, kscaleb, 0)));
+            _mm256_storeu_si256((__m256i *) (dstRow + x),
+                                shadowPixelsAVX2(sum, vamin, vamax, scaled, opaque));
+        }
+        for (; x < dstw; x++) {
+            jint suma = sums[x];
+            if (subRow != NULL) suma -= (subRow[x] >> 24) & 0xff;
+            if (addRow != NULL) suma += (addRow[x] >> 24) & 0xff;
+            sums[x] = suma;
+            dstRow[x] = shadowPixel(suma, amin, amax, kscales, shadowRGB);
+        }
+    }
+    free(sums);
+}
+
+static const DecoraKernels avx2Kernels = {
+    "avx2",
+    boxBlurHorizontalAVX2,
+    boxBlurVerticalAVX2,
+    boxShadowHorizontalBlackAVX2,
+    boxShadowVerticalBlackAVX2,
+    boxShadowVerticalAVX2,
+    // A single pixel already fills the 4 float lanes the convolution needs
+    linearConvolveHVSSE41,
+};
+
+static void detectX86Features(bool *sse41, bool *avx2)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    *sse41 = (info[2] & (1 << 19)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    *avx2 = false;
+    // AVX2 also needs the OS to save the upper halves of the ymm registers
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        *avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    *sse41 = __builtin_cpu_supports("sse4.1") != 0;
+    *avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif /* DECORA_KERNELS_X86 */
+
+#ifdef DECORA_KERNELS_NEON
+
+static inline uint32x4_t unpackPixelNEON(jint rgb)
+{
+    uint8x8_t b = vreinterpret_u8_u32(vdup_n_u32((uint32_t) rgb));
+    return vmovl_u16(vget_low_u16(vmovl_u8(b)));
+}
+
+static inline jint packPixelNEON(uint32x4_t v)
+{
+    uint16x4_t h = vmovn_u32(v);
+    uint8x8_t b = vmovn_u16(vcombine_u16(h, h));
+    return (jint) vget_lane_u32(vreinterpret_u32_u8(b), 0);
+}
+
+static inline int32x4_t loadAlphaNEON(const jint *src)
+{
+    return vreinterpretq_s32_u32(vshrq_n_u32(vld1q_u32((const uint32_t *) src), 24));
+}
+
+static inline int32x4_t shadowPixelsNEON(int32x4_t suma, int32x4_t amin, int32x4_t amax,
+                                         int32x4_t scaled, int32x4_t opaque)
+{
+    int32x4_t v = vbslq_s32(vcltq_s32(suma, amax), scaled, opaque);
+    return vbicq_s32(v, vreinterpretq_s32_u32(vcltq_s32(suma, amin)));
+}
+
+#define scaleAlphaNEON(suma, kscale, shift) \
+    vshlq_n_s32(vshrq_n_s32(vmulq_s32((suma), (kscale)), 23), (shift))
+
+static void boxBlurHorizontalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    uint32x4_t kscale = vdupq_n_u32((uint32_t) (0x7fffffff / (hsize * 255)));
+    for (jint y = 0; y < dsth; y++) {
+        jint *srcRow = srcPixels + y * srcscan;
+        jint *dstRow = dstPixels + y * dstscan;
+        uint32x4_t sum = vdupq_n_u32(0);
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = vsubq_u32(sum, unpackPixelNEON(srcRow[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = vaddq_u32(sum, unpackPixelNEON(srcRow[x]));
+            }
+            dstRow[x] = packPixelNEON(vshrq_n_u32(vmulq_u32(sum, kscale), 23));
+        }
+    }
+}
+
+static void boxBlurVerticalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srch, jint srcscan)
+{
+    uint32_t *sums = (uint32_t *) calloc((size_t) dstw * 4, sizeof(uint32_t));
+    if (sums == NULL) {
+        boxBlurVerticalScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    uint32x4_t kscale = vdupq_n_u32((uint32_t) (0x7fffffff / (vsize * 255)));
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        for (jint x = 0; x < dstw; x++) {
+            uint32x4_t sum = vld1q_u32(sums + x * 4);
+            if (subRow != NULL) {
+                sum = vsubq_u32(sum, unpackPixelNEON(subRow[x]));
+            }
+            if (addRow != NULL) {
+                sum = vaddq_u32(sum, unpackPixelNEON(addRow[x]));
+            }
+            vst1q_u32(sums + x * 4, sum);
+            dstRow[x] = packPixelNEON(vshrq_n_u32(vmulq_u32(sum, kscale), 23));
+        }
+    }
+    free(sums);
+}
+
+static void boxShadowHorizontalBlackNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                         jint *srcPixels, jint srcw, jint srcscan,
+                                         jint amin, jint amax, jint kscale)
+{
+    jint hsize = dstw - srcw + 1;
+    int32x4_t vamin = vdupq_n_s32(amin);
+    int32x4_t vamax = vdupq_n_s32(amax);
+    int32x4_t vkscale = vdupq_n_s32(kscale);
+    int32x4_t opaque = vdupq_n_s32((jint) 0xff000000);
+    jint column[4];
+    jint y = 0;
+    // Four rows at a time, one per lane.
+    for (; y + 4 <= dsth; y += 4) {
+        jint *srcRow = srcPixels + y * srcscan;
+        jint *dstRow = dstPixels + y * dstscan;
+        int32x4_t sum = vdupq_n_s32(0);
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                jint *s = srcRow + x - hsize;
+                column[0] = s[0];
+                column[1] = s[srcscan];
+                column[2] = s[2 * srcscan];
+                column[3] = s[3 * srcscan];
+                sum = vsubq_s32(sum, loadAlphaNEON(column));
+            }
+            if (x < srcw) {
+                jint *s = srcRow + x;
+                column[0] = s[0];
+                column[1] = s[srcscan];
+                column[2] = s[2 * srcscan];
+                column[3] = s[3 * srcscan];
+                sum = vaddq_s32(sum, loadAlphaNEON(column));
+            }
+            vst1q_s32(column, shadowPixelsNEON(sum, vamin, vamax,
+                                               scaleAlphaNEON(sum, vkscale, 24), opaque));
+            jint *d = dstRow + x;
+            d[0] = column[0];
+            d[dstscan] = column[1];
+            d[2 * dstscan] = column[2];
+            d[3 * dstscan] = column[3];
+        }
+    }
+    if (y < dsth) {
+        boxShadowHorizontalBlackScalar(dstPixels + y * dstscan, dstw, dsth - y, dstscan,
+                                       srcPixels + y * srcscan, srcw, srcscan,
+                                       amin, amax, kscale);
+    }
+}
+
+static void boxShadowVerticalBlackNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                       jint *srcPixels, jint srch, jint srcscan,
+                                       jint amin, jint amax, jint kscale)
+{
+    jint *sums = (jint *) calloc((size_t) dstw, sizeof(jint));
+    if (sums == NULL) {
+        boxShadowVerticalBlackScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan,
+                                     amin, amax, kscale);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    int32x4_t vamin = vdupq_n_s32(amin);
+    int32x4_t vamax = vdupq_n_s32(amax);
+    int32x4_t vkscale = vdupq_n_s32(kscale);
+    int32x4_t opaque = vdupq_n_s32((jint) 0xff000000);
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        // Four columns at a time, one per lane.
+        for (; x + 4 <= dstw; x += 4) {
+            int32x4_t sum = vld1q_s32(sums + x);
+            if (subRow != NULL) sum = vsubq_s32(sum, loadAlphaNEON(subRow + x));
+            if (addRow != NULL) sum = vaddq_s32(sum, loadAlphaNEON(addRow + x));
+            vst1q_s32(sums + x, sum);
+            vst1q_s32(dstRow + x, shadowPixelsNEON(sum, vamin, vamax,
+                                                   scaleAlphaNEON(sum, vkscale, 24), opaque));
+        }
+        for (; x < dstw; x++) {
+            jint suma = sums[x];
+            if (subRow != NULL) suma -= (subRow[x] >> 24) & 0xff;
+            if (addRow != NULL) suma += (addRow[x] >> 24) & 0xff;
+            sums[x] = suma;
+            dstRow[x] = shadowPixelBlack(suma, amin, amax, kscale);
+        }
+    }
+    free(sums);
+}
+
+static void boxShadowVerticalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan,
+                                  jint amin, jint amax, const jint *kscales,
+                                  jint shadowRGB)
+{
+    jint *sums = (jint *) calloc((size_t) dstw, sizeof(jint));
+    if (sums == NULL) {
+        boxShadowVerticalScalar(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan,
+                                amin, amax, kscales, shadowRGB);
+        return;
+    }
+    jint vsize = dsth - srch + 1;
+    int32x4_t vamin = vdupq_n_s32(amin);
+    int32x4_t vamax = vdupq_n_s32(amax);
+    int32x4_t kscalea = vdupq_n_s32(kscales[0]);
+    int32x4_t kscaler = vdupq_n_s32(kscales[1]);
+    int32x4_t kscaleg = vdupq_n_s32(kscales[2]);
+    int32x4_t kscaleb = vdupq_n_s32(kscales[3]);
+    int32x4_t opaque = vdupq_n_s32(shadowRGB);
+    for (jint y = 0; y < dsth; y++) {
+        jint *subRow = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *addRow = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dstRow = dstPixels + y * dstscan;
+        jint x = 0;
+        for (; x + 4 <= dstw; x += 4) {
+            int32x4_t sum = vld1q_s32(sums + x);
+            if (subRow != NULL) sum = vsubq_s32(sum, loadAlphaNEON(subRow + x));
+            if (addRow != NULL) sum = vaddq_s32(sum, loadAlphaNEON(addRow + x));
+            vst1q_s32(sums + x, sum);
+            int32x4_t scaled = vorrq_s32(
+                vorrq_s32(scaleAlphaNEON(sum, kscalea, 24), scaleAlphaNEON(sum, kscaler, 16)),
+                vorrq_s32(scaleAlphaNEON(sum, kscaleg, 8), vshrq_n_s32(vmulq_s32(sum, kscaleb), 23)));
+            vst1q_s32(dstRow + x, shadowPixelsNEON(sum, vamin, vamax, scaled, opaque));
+        }
+        for (; x < dstw; x++) {
+            jint suma = sums[x];
+            if (subRow != NULL) suma -= (subRow[x] >> 24) & 0xff;
+            if (addRow != NULL) suma += (addRow[x] >> 24) & 0xff;
+            sums[x] = suma;
+            dstRow[x] = shadowPixel(suma, amin, amax, kscales, shadowRGB);
+        }
+    }
+    free(sums);
+}
+
+static void linearConvolveHVNEON(jint *dstPixels, jint dstcols, jint dstrows,
+                                 jint dcolinc, jint drowinc,
+                                 jint *srcPixels, jint srccols,
+                                 jint scolinc, jint srowinc,
+                                 const jfloat *kvals, jint kernelSize)
+{
+    float32x4_t cvals[128];
+    float32x4_t vcmin = vdupq_n_f32(cmin);
+    float32x4_t vcmax = vdupq_n_f32(cmax);
+    uint32x4_t v255 = vdupq_n_u32(255);
+    jint dstrow = 0;
+    jint srcrow = 0;
+    for (jint r = 0; r < dstrows; r++) {
+        jint dstoff = dstrow;
+        jint srcoff = srcrow;
+        for (jint i = 0; i < kernelSize; i++) {
+            cvals[i] = vdupq_n_f32(0.0f);
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            cvals[kernelSize - koff] = vcvtq_f32_u32(unpackPixelNEON(rgb));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = vaddq_f32(sum, vmulq_n_f32(cvals[i], kvals[koff + i]));
+            }
+            uint32x4_t v = vreinterpretq_u32_s32(vcvtq_s32_f32(sum));
+            v = vbslq_u32(vcgtq_f32(sum, vcmax), v255, v);
+            v = vbicq_u32(v, vcltq_f32(sum, vcmin));
+            dstPixels[dstoff] = packPixelNEON(v);
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+}
+
+static const DecoraKernels neonKernels = {
+    "neon",
+    boxBlurHorizontalNEON,
+    boxBlurVerticalNEON,
+    boxShadowHorizontalBlackNEON,
+    boxShadowVerticalBlackNEON,
+    boxShadowVerticalNEON,
+    linearConvolveHVNEON,
+};
+
+#endif /* DECORA_KERNELS_NEON */
+
+typedef struct {
+    const DecoraKernels *kernels;
+    bool supported;
+} KernelChoice;
+
+static const DecoraKernels *selectedKernels = NULL;
+
+/*
+ * Picks the first supported kernels, best first, starting from the ones
+ * named by preferred; an unknown or missing name means no limit.
+ */
+static const DecoraKernels *chooseKernels(const char *preferred)
+{
+    KernelChoice choices[4];
+    int count = 0;
+#ifdef DECORA_KERNELS_X86
+    bool sse41, avx2;
+    detectX86Features(&sse41, &avx2);
+    choices[count].kernels = &avx2Kernels;
+    choices[count++].supported = avx2;
+    choices[count].kernels = &sse41Kernels;
+    choices[count++].supported = sse41;
+#endif
+#ifdef DECORA_KERNELS_NEON
+    // NEON is part of the baseline on the ARM targets we build
+    choices[count].kernels = &neonKernels;
+    choices[count++].supported = true;
+#endif
+    choices[count].kernels = &scalarKernels;
+    choices[count++].supported = true;
+
+    int first = 0;
+    if (preferred != NULL) {
+        for (int i = 0; i < count; i++) {
+            if (strcmp(choices[i].kernels->name, preferred) == 0) {
+                first = i;
+                break;
+            }
+        }
+    }
+    for (int i = first; i < count; i++) {
+        if (choices[i].supported) {
+            return choices[i].kernels;
+        }
+    }
+    return &scalarKernels;
+}
+
+const DecoraKernels *getDecoraKernels()
+{
+    if (selectedKernels == NULL) {
+        selectedKernels = chooseKernels(NULL);
+    }
+    return selectedKernels;
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_selectKernels
+    (JNIEnv *env, jclass klass, jstring preferred_str)
+{
+    const char *preferred = NULL;
+    if (preferred_str != NULL) {
+        preferred = env->GetStringUTFChars(preferred_str, NULL);
+        if (preferred == NULL) return NULL;
+    }
+    selectedKernels = chooseKernels(preferred);
+    if (preferred != NULL) {
+        env->ReleaseStringUTFChars(preferred_str, preferred);
+    }
+    return env->NewStringUTF(selectedKernels->name);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_SSEKernels
+#define _Included_SSEKernels
+
+#include <jni.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Inner loops of the box blur, box shadow and linear convolve peers.
+ * Each entry processes already pinned pixel arrays and produces exactly
+ * the same pixels as the scalar loops (and the Java peers they mirror);
+ * the vector variants only change how many channels, rows or columns
+ * are accumulated per instruction.
+ */
+typedef struct {
+    const char *name;
+
+    void (*boxBlurHorizontal)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                              jint *srcPixels, jint srcw, jint srcscan);
+    void (*boxBlurVertical)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                            jint *srcPixels, jint srch, jint srcscan);
+
+    void (*boxShadowHorizontalBlack)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                     jint *srcPixels, jint srcw, jint srcscan,
+                                     jint amin, jint amax, jint kscale);
+    void (*boxShadowVerticalBlack)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                   jint *srcPixels, jint srch, jint srcscan,
+                                   jint amin, jint amax, jint kscale);
+    void (*boxShadowVertical)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                              jint *srcPixels, jint srch, jint srcscan,
+                              jint amin, jint amax, const jint *kscales,
+                              jint shadowRGB);
+
+    void (*linearConvolveHV)(jint *dstPixels, jint dstcols, jint dstrows,
+                             jint dcolinc, jint drowinc,
+                             jint *srcPixels, jint srccols,
+                             jint scolinc, jint srowinc,
+                             const jfloat *kvals, jint kernelSize);
+} DecoraKernels;
+
+/*
+ * Returns the kernels for the best instruction set supported by the
+ * processor, limited by any preference passed to
+ * SSERendererDelegate.selectKernels(). Without such a call the choice is
+ * made once, on first use.
+ */
+const DecoraKernels *getDecoraKernels();
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif /* _Included_SSEKernels */
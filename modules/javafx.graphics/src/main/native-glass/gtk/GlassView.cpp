@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,24 @@
 
 #define JLONG_TO_GLASSVIEW(value) ((GlassView *) JLONG_TO_PTR(value))
 
+// Copies the dirty rectangles (x, y, width, height quadruples) passed with an
+// upload. Returns false if the whole image should be painted.
+static bool get_dirty_rects(JNIEnv *env, jintArray jrects, std::vector<jint> &rects)
+{
+    if (!jrects) return false;
+
+    jsize length = env->GetArrayLength(jrects);
+    if (length < 4) return false;
+
+    rects.resize(length - length % 4);
+    env->GetIntArrayRegion(jrects, 0, (jsize) rects.size(), rects.data());
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return false;
+    }
+    return true;
+}
+
 extern "C" {
 
 /*
@@ -178,10 +196,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1scheduleRepaint
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsDirect
- * Signature: (JLjava/nio/Buffer;II)V
+ * Signature: (JLjava/nio/Buffer;II[I)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
-(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height)
+(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height, jintArray jrects)
 {
     (void)jView;
 
@@ -191,18 +209,21 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         void *data = env->GetDirectBufferAddress(buffer);
+        std::vector<jint> rects;
+        bool dirty = get_dirty_rects(env, jrects, rects);
 
-        view->current_window->paint(data, width, height);
+        view->current_window->paint(data, width, height,
+                dirty ? rects.data() : NULL, dirty ? (jint) rects.size() / 4 : 0);
     }
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsIntArray
- * Signature:  (J[IIII)V
+ * Signature:  (J[IIII[I)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
-  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height, jintArray jrects)
 {
     (void)obj;
 
@@ -223,10 +244,15 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        // Rectangles must be copied before entering the critical region
+        std::vector<jint> rects;
+        bool dirty = get_dirty_rects(env, jrects, rects);
+
         int *data = NULL;
         data = (int*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height,
+                dirty ? rects.data() : NULL, dirty ? (jint) rects.size() / 4 : 0);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -235,10 +261,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsByteArray
- * Signature:  (J[BIII)V
+ * Signature:  (J[BIII[I)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
-  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height, jintArray jrects)
 {
     (void)obj;
 
@@ -259,11 +285,16 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        // Rectangles must be copied before entering the critical region
+        std::vector<jint> rects;
+        bool dirty = get_dirty_rects(env, jrects, rects);
+
         unsigned char *data = NULL;
 
         data = (unsigned char*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height,
+                dirty ? rects.data() : NULL, dirty ? (jint) rects.size() / 4 : 0);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -572,6 +572,7 @@ typedef struct _DeviceGrabContext {
 } DeviceGrabContext;
 
 gboolean disableGrab = FALSE;
+gboolean disableShm = FALSE;
 static gboolean configure_transparent_window(GtkWidget *window);
 static void configure_opaque_window(GtkWidget *window);
 
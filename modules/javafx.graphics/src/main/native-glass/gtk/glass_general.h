@@ -54,6 +54,8 @@
 extern JNIEnv* mainEnv; // Use only with main loop thread!!!
 extern JavaVM* javaVM;
 
+extern gboolean disableShm;
+
 #define GLASS_GDK_KEY_CONSTANT(key) (GDK_KEY_ ## key)
 
 #include <exception>
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "glass_shm.h"
+#include "glass_general.h"
+
+#include <cstring>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include <gdk/gdkx.h>
+#include <X11/Xutil.h>
+
+ShmPresenter* ShmPresenter::create(GdkWindow* gdk_window) {
+    if (disableShm || gdk_window == NULL) {
+        return NULL;
+    }
+
+    Display* display = GDK_DISPLAY_XDISPLAY(gdk_window_get_display(gdk_window));
+    if (!XShmQueryExtension(display)) {
+        return NULL;
+    }
+
+    // Prism uploads premultiplied BGRA in native byte order, only visuals
+    // with the same layout can take the pixels without conversion
+    GdkVisual* gdk_visual = gdk_window_get_visual(gdk_window);
+    Visual* visual = gdk_x11_visual_get_xvisual(gdk_visual);
+    int depth = glass_gdk_visual_get_depth(gdk_visual);
+    if ((depth != 24 && depth != 32)
+            || visual->red_mask != 0xff0000
+            || visual->green_mask != 0xff00
+            || visual->blue_mask != 0xff) {
+        return NULL;
+    }
+
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+    if (ImageByteOrder(display) != LSBFirst) {
+#else
+    if (ImageByteOrder(display) != MSBFirst) {
+#endif
+        return NULL;
+    }
+
+    return new ShmPresenter(display, GDK_WINDOW_XID(gdk_window), visual, depth);
+}
+
+ShmPresenter::ShmPresenter(Display* _display, Window _xwindow, Visual* _visual, int _depth)
+        : display(_display), xwindow(_xwindow), visual(_visual), depth(_depth),
+          next(0), last_region(NULL) {
+    gc = XCreateGC(display, xwindow, 0, NULL);
+    memset(buffers, 0, sizeof(buffers));
+}
+
+ShmPresenter::~ShmPresenter() {
+    destroy_buffers();
+    XFreeGC(display, gc);
+}
+
+bool ShmPresenter::create_buffer(ShmBuffer* buffer, jint width, jint height) {
+    memset(buffer, 0, sizeof(ShmBuffer));
+    buffer->info.shmid = -1;
+
+    buffer->image = XShmCreateImage(display, visual, depth, ZPixmap, NULL,
+            &buffer->info, width, height);
+    if (buffer->image == NULL) {
+        return false;
+    }
+    if (buffer->image->bits_per_pixel != 32) {
+        destroy_buffer(buffer);
+        return false;
+    }
+
+    buffer->info.shmid = shmget(IPC_PRIVATE,
+            (size_t) buffer->image->bytes_per_line * height, IPC_CREAT | 0600);
+    if (buffer->info.shmid == -1) {
+        destroy_buffer(buffer);
+        return false;
+    }
+
+    buffer->info.shmaddr = (char*) shmat(buffer->info.shmid, NULL, 0);
+    if (buffer->info.shmaddr == (char*) -1) {
+        buffer->info.shmaddr = NULL;
+        destroy_buffer(buffer);
+        return false;
+    }
+    buffer->image->data = buffer->info.shmaddr;
+    buffer->info.readOnly = False;
+
+    // The attach fails on a remote server, which is only reported
+    // asynchronously
+    gdk_error_trap_push();
+    Bool attached = XShmAttach(display, &buffer->info);
+    XSync(display, False);
+    if (gdk_error_trap_pop() || !attached) {
+        // Not attached, so it must not be detached
+        buffer->info.shmseg = 0;
+        destroy_buffer(buffer);
+        return false;
+    }
+
+    // The segment goes away once both sides have detached it, even if the
+    // process dies
+    shmctl(buffer->info.shmid, IPC_RMID, NULL);
+    buffer->info.shmid = -1;
+    return true;
+}
+
+void ShmPresenter::destroy_buffer(ShmBuffer* buffer) {
+    if (buffer->info.shmseg != 0) {
+        XShmDetach(display, &buffer->info);
+        XSync(display, False);
+    }
+    if (buffer->info.shmaddr != NULL) {
+        shmdt(buffer->info.shmaddr);
+    }
+    if (buffer->info.shmid != -1) {
+        shmctl(buffer->info.shmid, IPC_RMID, NULL);
+    }
+    if (buffer->image != NULL) {
+        buffer->image->data = NULL;
+        XDestroyImage(buffer->image);
+    }
+    memset(buffer, 0, sizeof(ShmBuffer));
+}
+
+void ShmPresenter::destroy_buffers() {
+    for (int i = 0; i < SHM_BUFFER_COUNT; i++) {
+        if (buffers[i].image != NULL) {
+            destroy_buffer(&buffers[i]);
+        }
+    }
+    if (last_region != NULL) {
+        cairo_region_destroy(last_region);
+        last_region = NULL;
+    }
+}
+
+void ShmPresenter::wait_buffer(ShmBuffer* buffer) {
+    // The server has read the image once the request that put it is processed
+    if (buffer->serial != 0 && LastKnownRequestProcessed(display) < buffer->serial) {
+        XSync(display, False);
+    }
+}
+
+bool ShmPresenter::present(void* data, jint width, jint height, cairo_region_t* region) {
+    ShmBuffer* buffer = &buffers[next];
+
+    if (buffer->image == NULL
+            || buffer->image->width != width
+            || buffer->image->height != height) {
+        destroy_buffers();
+        for (int i = 0; i < SHM_BUFFER_COUNT; i++) {
+            if (!create_buffer(&buffers[i], width, height)) {
+                destroy_buffers();
+                return false;
+            }
+        }
+        buffer = &buffers[next];
+    }
+
+    wait_buffer(buffer);
+
+    // The buffer is a frame behind, the rectangles that changed in the other
+    // buffer have to be brought up to date as well
+    cairo_region_t* copy_region;
+    if (!buffer->valid) {
+        cairo_rectangle_int_t bounds = {0, 0, width, height};
+        copy_region = cairo_region_create_rectangle(&bounds);
+    } else {
+        copy_region = cairo_region_copy(region);
+        if (last_region != NULL) {
+            cairo_region_union(copy_region, last_region);
+        }
+    }
+
+    const char* src = (const char*) data;
+    int count = cairo_region_num_rectangles(copy_region);
+    for (int i = 0; i < count; i++) {
+        cairo_rectangle_int_t rect;
+        cairo_region_get_rectangle(copy_region, i, &rect);
+        for (int y = rect.y; y < rect.y + rect.height; y++) {
+            memcpy(buffer->image->data + (size_t) y * buffer->image->bytes_per_line + rect.x * 4,
+                    src + ((size_t) y * width + rect.x) * 4,
+                    (size_t) rect.width * 4);
+        }
+    }
+    cairo_region_destroy(copy_region);
+    buffer->valid = true;
+
+    count = cairo_region_num_rectangles(region);
+    for (int i = 0; i < count; i++) {
+        cairo_rectangle_int_t rect;
+        cairo_region_get_rectangle(region, i, &rect);
+        XShmPutImage(display, xwindow, gc, buffer->image,
+                rect.x, rect.y, rect.x, rect.y, rect.width, rect.height, False);
+    }
+    buffer->serial = NextRequest(display) - 1;
+    XFlush(display);
+
+    if (last_region != NULL) {
+        cairo_region_destroy(last_region);
+    }
+    last_region = cairo_region_copy(region);
+    next = (next + 1) % SHM_BUFFER_COUNT;
+    return true;
+}
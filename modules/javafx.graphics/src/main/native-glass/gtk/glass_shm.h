@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef GLASS_SHM_H
+#define GLASS_SHM_H
+
+#include <jni.h>
+
+#include <gtk/gtk.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
+
+#define SHM_BUFFER_COUNT 2
+
+// Presents software rendered frames through MIT-SHM images, so the X server
+// reads the pixels from shared memory instead of receiving them over the
+// connection. Two images are used in turn, a frame is only written into an
+// image once the server is done with the previous request that used it.
+class ShmPresenter {
+    struct ShmBuffer {
+        XImage* image;
+        XShmSegmentInfo info;
+        unsigned long serial;
+        bool valid;
+    };
+
+    Display* display;
+    Window xwindow;
+    Visual* visual;
+    int depth;
+    GC gc;
+
+    ShmBuffer buffers[SHM_BUFFER_COUNT];
+    int next;
+    // Region written into the other buffer by the previous frame, it has to
+    // be copied again when the buffers are swapped.
+    cairo_region_t* last_region;
+
+    ShmPresenter(Display*, Window, Visual*, int);
+
+    bool create_buffer(ShmBuffer*, jint, jint);
+    void destroy_buffer(ShmBuffer*);
+    void destroy_buffers();
+    void wait_buffer(ShmBuffer*);
+public:
+    static ShmPresenter* create(GdkWindow*);
+
+    bool present(void*, jint, jint, cairo_region_t*);
+
+    ~ShmPresenter();
+};
+
+#endif /* GLASS_SHM_H */
@@ -27,6 +27,7 @@
 #include "glass_key.h"
 #include "glass_screen.h"
 #include "glass_dnd.h"
+#include "glass_shm.h"
 
 #include <com_sun_glass_events_WindowEvent.h>
 #include <com_sun_glass_events_ViewEvent.h>
@@ -503,33 +504,119 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
-#ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
-    cairo_region_t *region = cairo_region_create_rectangle(&rect);
-    gdk_window_begin_paint_region(gdk_window, region);
-#endif
-    cairo_t* context = gdk_cairo_create(gdk_window);
+cairo_surface_t* WindowContextBase::get_paint_surface(void* data, jint width, jint height) {
+    for (int i = 0; i < PAINT_SURFACE_CACHE_SIZE; i++) {
+        cairo_surface_t* surface = paint_surfaces[i];
+        if (surface != NULL
+                && cairo_image_surface_get_data(surface) == (unsigned char*)data
+                && cairo_image_surface_get_width(surface) == width
+                && cairo_image_surface_get_height(surface) == height) {
+            return surface;
+        }
+    }
 
-    cairo_surface_t* cairo_surface =
+    cairo_surface_t* surface =
         cairo_image_surface_create_for_data(
             (unsigned char*)data,
             CAIRO_FORMAT_ARGB32,
             width, height, width * 4);
 
+    int slot = paint_surface_next;
+    paint_surface_next = (paint_surface_next + 1) % PAINT_SURFACE_CACHE_SIZE;
+    if (paint_surfaces[slot] != NULL) {
+        cairo_surface_destroy(paint_surfaces[slot]);
+    }
+    paint_surfaces[slot] = surface;
+    return surface;
+}
+
+void WindowContextBase::release_paint_surfaces() {
+    for (int i = 0; i < PAINT_SURFACE_CACHE_SIZE; i++) {
+        if (paint_surfaces[i] != NULL) {
+            cairo_surface_destroy(paint_surfaces[i]);
+            paint_surfaces[i] = NULL;
+        }
+    }
+}
+
+void WindowContextBase::paint(void* data, jint width, jint height, const jint* dirty_rects, jint dirty_count) {
+    cairo_rectangle_int_t bounds = {0, 0, width, height};
+    cairo_region_t *region;
+
+    // Only the rectangles that changed since the last upload are painted,
+    // the rest of the window keeps its previous contents.
+    if (dirty_rects != NULL && dirty_count > 0) {
+        region = cairo_region_create();
+        for (jint i = 0; i < dirty_count; i++) {
+            const jint* r = dirty_rects + 4 * i;
+            cairo_rectangle_int_t rect = {r[0], r[1], r[2], r[3]};
+            cairo_region_union_rectangle(region, &rect);
+        }
+        cairo_region_intersect_rectangle(region, &bounds);
+    } else {
+        region = cairo_region_create_rectangle(&bounds);
+    }
+
+    if (cairo_region_is_empty(region)) {
+        cairo_region_destroy(region);
+        return;
+    }
+
     applyShapeMask(data, width, height);
 
+    if (!shm_checked) {
+        shm_checked = true;
+        shm_presenter = ShmPresenter::create(gdk_window);
+        if (gtk_verbose) {
+            fprintf(stderr, "Glass GTK: presenting through %s\n",
+                    shm_presenter != NULL ? "MIT-SHM" : "cairo");
+        }
+    }
+    if (shm_presenter != NULL) {
+        if (shm_presenter->present(data, width, height, region)) {
+            cairo_region_destroy(region);
+            return;
+        }
+        // Shared memory is not usable with this server, stay on cairo
+        if (gtk_verbose) {
+            fprintf(stderr, "Glass GTK: MIT-SHM failed, presenting through cairo\n");
+        }
+        delete shm_presenter;
+        shm_presenter = NULL;
+    }
+
+    cairo_surface_t* cairo_surface = get_paint_surface(data, width, height);
+
+    // The surface may be reused for a buffer with new contents
+    int count = cairo_region_num_rectangles(region);
+    for (int i = 0; i < count; i++) {
+        cairo_rectangle_int_t rect;
+        cairo_region_get_rectangle(region, i, &rect);
+        cairo_surface_mark_dirty_rectangle(cairo_surface, rect.x, rect.y, rect.width, rect.height);
+    }
+
+#ifdef GLASS_GTK3
+    gdk_window_begin_paint_region(gdk_window, region);
+#endif
+    cairo_t* context = gdk_cairo_create(gdk_window);
+
+    for (int i = 0; i < count; i++) {
+        cairo_rectangle_int_t rect;
+        cairo_region_get_rectangle(region, i, &rect);
+        cairo_rectangle(context, rect.x, rect.y, rect.width, rect.height);
+    }
+    cairo_clip(context);
+
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
     cairo_paint(context);
 
 #ifdef GLASS_GTK3
     gdk_window_end_paint(gdk_window);
-    cairo_region_destroy(region);
 #endif
 
     cairo_destroy(context);
-    cairo_surface_destroy(cairo_surface);
+    cairo_region_destroy(region);
 }
 
 void WindowContextBase::add_child(WindowContextTop* child) {
@@ -673,6 +760,8 @@ bool WindowContextBase::get_window_edge(int x, int y, GdkWindowEdge* window_edge
 }
 
 WindowContextBase::~WindowContextBase() {
+    delete shm_presenter;
+    release_paint_surfaces();
     disableIME();
     gtk_widget_destroy(gtk_widget);
 }
@@ -35,6 +35,9 @@
 #include "DeletedMemDebug.h"
 
 #include "glass_view.h"
+#include "glass_shm.h"
+
+#define PAINT_SURFACE_CACHE_SIZE 3
 
 enum WindowManager {
     COMPIZ,
@@ -109,7 +112,7 @@ public:
     virtual void setOnPreEdit(bool) = 0;
     virtual void commitIME(gchar *) = 0;
 
-    virtual void paint(void* data, jint width, jint height) = 0;
+    virtual void paint(void* data, jint width, jint height, const jint* dirty_rects, jint dirty_count) = 0;
     virtual WindowGeometry get_geometry() = 0;
 
     virtual void show_system_menu(int x, int y) = 0;
@@ -201,6 +204,18 @@ protected:
     GdkCursor* gdk_cursor_override = NULL;
     GdkWMFunction gdk_windowManagerFunctions;
 
+    // Surfaces wrapping recently uploaded pixel buffers, reused while the
+    // same buffers keep coming back from the pixel queue.
+    cairo_surface_t* paint_surfaces[PAINT_SURFACE_CACHE_SIZE] = {};
+    int paint_surface_next = 0;
+
+    cairo_surface_t* get_paint_surface(void*, jint, jint);
+    void release_paint_surfaces();
+
+    // Presents uploads through MIT-SHM when the server supports it
+    ShmPresenter* shm_presenter = NULL;
+    bool shm_checked = false;
+
     bool is_iconified;
     bool is_maximized;
     bool is_mouse_entered;
@@ -233,7 +248,7 @@ public:
     void commitIME(gchar *);
     void updateCaretPos();
     void disableIME();
-    void paint(void*, jint, jint);
+    void paint(void*, jint, jint, const jint*, jint);
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1320,6 +1320,9 @@ JNIEXPORT jlong JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initDecompr
     return ptr_to_jlong(data);
 }
 
+/* Denominator of the scaling fractions applied while decoding */
+#define DCT_SCALE_DENOM 8
+
 JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompression
 (JNIEnv *env, jobject this, jlong ptr, jint outCS, jint dest_width, jint dest_height) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
@@ -1360,32 +1363,30 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     cinfo->out_color_space = outCS;
 
     /* decide how much we want to sub-sample the incoming jpeg image.
-     * The libjpeg docs say:
-     *
-     *     unsigned int scale_num, scale_denom
-     *
-     *     Scale the image by the fraction scale_num/scale_denom.  Default is
-     *     1/1, or no scaling.  Currently, the only supported scaling ratios
-     *     are 1/1, 1/2, 1/4, and 1/8.  (The library design allows for arbitrary
-     *     scaling ratios but this is not likely to be implemented any time soon.)
-     *     Smaller scaling ratios permit significantly faster decoding since
-     *     fewer pixels need be processed and a simpler IDCT method can be used.
+     * The library can scale the image by any fraction N/8 with 1 <= N <= 16
+     * while decoding, by using a smaller or larger IDCT. Smaller scaling
+     * ratios permit significantly faster decoding since fewer pixels need be
+     * processed, so pick the smallest N that still produces an image at
+     * least as large as the requested one. The remaining downscale, if any,
+     * is done in Java.
      */
 
-    cinfo->scale_num = 1;
-
     x_scale = (jfloat) dest_width / (jfloat) cinfo->image_width;
     y_scale = (jfloat) dest_height / (jfloat) cinfo->image_height;
     max_scale = x_scale > y_scale ? x_scale : y_scale;
 
-    if (max_scale > 0.5) {
+    if (max_scale >= 1.0) {
+        cinfo->scale_num = 1;
         cinfo->scale_denom = 1;
-    } else if (max_scale > 0.25) {
-        cinfo->scale_denom = 2;
-    } else if (max_scale > 0.125) {
-        cinfo->scale_denom = 4;
     } else {
-        cinfo->scale_denom = 8;
+        unsigned int num = 1;
+        while (num < DCT_SCALE_DENOM &&
+               ((jlong) cinfo->image_width * num < (jlong) dest_width * DCT_SCALE_DENOM ||
+                (jlong) cinfo->image_height * num < (jlong) dest_height * DCT_SCALE_DENOM)) {
+            num++;
+        }
+        cinfo->scale_num = num;
+        cinfo->scale_denom = DCT_SCALE_DENOM;
     }
 
     jpeg_start_decompress(cinfo);
@@ -1405,6 +1406,13 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
         (PTR) = NULL;     \
     }
 
+/*
+ * Decoded rows are collected in bands of about this many bytes, so the
+ * Java array is entered and progress is reported once per band instead of
+ * once per scanline.
+ */
+#define DECODE_BAND_SIZE (64 * 1024)
+
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
 (JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
@@ -1413,7 +1421,10 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
     sun_jpeg_error_ptr jerr;
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
-    JSAMPROW scanline_ptr = NULL;
+    int band_rows;
+    int i;
+    JSAMPROW band_ptr = NULL;
+    JSAMPARRAY band_rows_ptr = NULL;
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1427,6 +1438,34 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
+    /* A band is never smaller than what a single read may return */
+    band_rows = DECODE_BAND_SIZE / bytes_per_row;
+    if (band_rows < cinfo->rec_outbuf_height) {
+        band_rows = cinfo->rec_outbuf_height;
+    }
+    if (band_rows > (int) cinfo->output_height) {
+        band_rows = cinfo->output_height;
+    }
+    if (band_rows < 1) {
+        band_rows = 1;
+    }
+
+    band_ptr = (JSAMPROW) malloc((size_t) bytes_per_row * band_rows * sizeof(JSAMPLE));
+    band_rows_ptr = (JSAMPARRAY) malloc(band_rows * sizeof(JSAMPROW));
+    if (band_ptr == NULL || band_rows_ptr == NULL) {
+        SAFE_FREE(band_ptr);
+        SAFE_FREE(band_rows_ptr);
+        unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Reading JPEG Stream");
+        return JNI_FALSE;
+    }
+
+    for (i = 0; i < band_rows; i++) {
+        band_rows_ptr[i] = band_ptr + (size_t) i * bytes_per_row;
+    }
+
     /* Establish the setjmp return context for sun_jpeg_error_exit to use. */
     jerr = (sun_jpeg_error_ptr) cinfo->err;
 
@@ -1440,21 +1479,13 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                     buffer);
             ThrowByName(env, "java/io/IOException", buffer);
         }
-        SAFE_FREE(scanline_ptr);
-        return JNI_FALSE;
-    }
-
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
-    if (scanline_ptr == NULL) {
-        unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
-        ThrowByName(env,
-                "java/lang/OutOfMemoryError",
-                "Reading JPEG Stream");
+        SAFE_FREE(band_ptr);
+        SAFE_FREE(band_rows_ptr);
         return JNI_FALSE;
     }
 
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
+        int num_scanlines = 0;
         if (report_progress == JNI_TRUE) {
             (*env)->CallVoidMethod(env, this,
                     JPEGImageLoader_updateImageProgressID,
@@ -1464,21 +1495,28 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
             }
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
+        while (num_scanlines < band_rows &&
+               cinfo->output_scanline < cinfo->output_height) {
+            num_scanlines += jpeg_read_scanlines(cinfo,
+                    band_rows_ptr + num_scanlines, band_rows - num_scanlines);
+        }
+
+        if (num_scanlines > 0) {
             jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
             if (body == NULL) {
                 unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
                 fprintf(stderr, "decompressIndirect: GetPrimitiveArrayCritical returns NULL: out of memory\n");
-                SAFE_FREE(scanline_ptr);
+                SAFE_FREE(band_ptr);
+                SAFE_FREE(band_rows_ptr);
                 return JNI_FALSE;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
-            (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            memcpy(body + offset, band_ptr, (size_t) bytes_per_row * num_scanlines);
+            (*env)->ReleasePrimitiveArrayCritical(env, barray, body, 0);
+            offset += bytes_per_row * num_scanlines;
         }
     }
-    SAFE_FREE(scanline_ptr);
+    SAFE_FREE(band_ptr);
+    SAFE_FREE(band_rows_ptr);
 
     if (report_progress == JNI_TRUE) {
         (*env)->CallVoidMethod(env, this,
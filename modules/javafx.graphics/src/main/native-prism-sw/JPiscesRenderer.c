@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #include <JTransform.h>
 
 #include <PiscesBlit.h>
+#include <PiscesParallel.h>
 #include <PiscesSysutils.h>
 
 #include <PiscesRenderer.inl>
@@ -40,6 +41,12 @@
 #define RENDERER_SURFACE 1
 #define RENDERER_LAST RENDERER_SURFACE
 
+/*
+ * Fills covering fewer pixels than this stay on the calling thread, where
+ * they finish faster than the worker threads can be woken up.
+ */
+#define PARALLEL_MIN_PIXELS (256 * 256)
+
 #define SURFACE_FROM_RENDERER(surface, env, surfaceHandle, rendererHandle)     \
         (surfaceHandle) = (*(env))->GetObjectField((env), (rendererHandle),    \
                                                    fieldIds[RENDERER_SURFACE]  \
@@ -55,6 +62,34 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask, jint x, jint y,
     jint maskWidth, jint maskHeight, jint offset, jint stride);
 
+/*
+ * State shared by the bands of a fill split across threads. Each band
+ * works on its own copy of the renderer, with its own paint buffer, and
+ * only the row-dependent fields set for its first row.
+ */
+typedef struct _FillBands {
+    Renderer* rdr;
+    jint x_from;
+    jint x_to;
+    jint x;
+    jint y_from;
+    jint rowNum;
+    jint maskOffset;
+    jint maskWidth;
+    jint scanlineStride;
+} FillBands;
+
+static void
+initBandRenderer(Renderer* band, FillBands* bands, jint firstRow) {
+    *band = *bands->rdr;
+    band->_paint = NULL;
+    band->_paint_length = 0;
+    band->_currX = bands->x_from;
+    band->_currY = bands->y_from + firstRow;
+    band->_currImageOffset = band->_currY * bands->scanlineStride;
+    band->_rowNum = bands->rowNum + firstRow;
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_pisces_PiscesRenderer_initialize(JNIEnv* env, jobject objectHandle)
 {
@@ -91,6 +126,12 @@ Java_com_sun_pisces_PiscesRenderer_disposeNative(JNIEnv *env, jclass cls, jlong
     }
 }
 
+JNIEXPORT void JNICALL
+Java_com_sun_pisces_PiscesRenderer_setThreadCountImpl(JNIEnv *env, jclass cls, jint threads)
+{
+    pisces_setThreadCount(threads);
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_pisces_PiscesRenderer_setClipImpl(JNIEnv* env, jobject objectHandle,
         jint minX, jint minY, jint width, jint height) {
@@ -368,6 +409,44 @@ toPiscesCoords(unsigned int ff) {
     return (int)gg;
 }
 
+/*
+ * Emits rows full (non-fractional) lines starting at the renderer's
+ * current row, NUM_ALPHA_ROWS at a time.
+ */
+static void
+emitFullLines(Renderer* rdr, jint rows, jint x_from, jint x_to, jint scanlineStride) {
+    jint rows_being_rendered;
+
+    while (rows > 0) {
+        rows_being_rendered = MIN(rows, NUM_ALPHA_ROWS);
+
+        if (rdr->_genPaint) {
+            size_t l = (x_to - x_from + 1) * rows_being_rendered;
+            ALLOC3(rdr->_paint, jint, l);
+            ASSERT_ALLOC(rdr->_paint);
+            rdr->_genPaint(rdr, rows_being_rendered);
+        }
+        rdr->_emitLine(rdr, rows_being_rendered, 0x10000);
+
+        rows -= rows_being_rendered;
+        rdr->_currX = x_from;
+        rdr->_currY += rows_being_rendered;
+        rdr->_currImageOffset = rdr->_currY * scanlineStride;
+        rdr->_rowNum += rows_being_rendered;
+    }
+}
+
+static void
+emitFullLinesBand(void* ctx, jint firstRow, jint numRows) {
+    FillBands* bands = (FillBands*)ctx;
+    Renderer band;
+
+    initBandRenderer(&band, bands, firstRow);
+    emitFullLines(&band, numRows, bands->x_from, bands->x_to,
+                  bands->scanlineStride);
+    my_free(band._paint);
+}
+
 static void
 fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     jint x, jint y, jint w, jint h,
@@ -377,7 +456,7 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     jobject surfaceHandle;
     jint x_from, x_to, y_from, y_to;
     jint lfrac, rfrac, tfrac, bfrac;
-    jint rows_to_render_by_loop, rows_being_rendered;
+    jint rows_to_render_by_loop;
 
     lfrac = (0x10000 - (x & 0xFFFF)) & 0xFFFF;
     rfrac = (x + w) & 0xFFFF;
@@ -507,21 +586,30 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
         }
 
         // emit "full" lines that are in the middle
-        while (rows_to_render_by_loop > 0) {
-            rows_being_rendered = MIN(rows_to_render_by_loop, NUM_ALPHA_ROWS);
-
-            if (rdr->_genPaint) {
-                size_t l = (x_to - x_from + 1) * rows_being_rendered;
-                ALLOC3(rdr->_paint, jint, l);
-                rdr->_genPaint(rdr, rows_being_rendered);
+        if (rows_to_render_by_loop > 0) {
+            FillBands bands;
+            bands.rdr = rdr;
+            bands.x_from = x_from;
+            bands.x_to = x_to;
+            bands.x = x_from;
+            bands.y_from = rdr->_currY;
+            bands.rowNum = rdr->_rowNum;
+            bands.maskOffset = 0;
+            bands.maskWidth = 0;
+            bands.scanlineStride = surface->width;
+
+            if (rows_to_render_by_loop * rdr->_alphaWidth >= PARALLEL_MIN_PIXELS &&
+                pisces_runBands(rows_to_render_by_loop, NUM_ALPHA_ROWS,
+                                emitFullLinesBand, &bands))
+            {
+                // leave the renderer where the single-threaded loop would
+                rdr->_currX = x_from;
+                rdr->_currY += rows_to_render_by_loop;
+                rdr->_currImageOffset = rdr->_currY * surface->width;
+                rdr->_rowNum += rows_to_render_by_loop;
+            } else {
+                emitFullLines(rdr, rows_to_render_by_loop, x_from, x_to, surface->width);
             }
-            rdr->_emitLine(rdr, rows_being_rendered, 0x10000);
-
-            rows_to_render_by_loop -= rows_being_rendered;
-            rdr->_currX = x_from;
-            rdr->_currY += rows_being_rendered;
-            rdr->_currImageOffset = rdr->_currY * surface->width;
-            rdr->_rowNum += rows_being_rendered;
         }
 
         // emit fractional bottom line
@@ -785,12 +873,56 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillLCDAlphaMaskImpl
         x, y, maskWidth, maskHeight, maskOffset, stride);
 }
 
+/*
+ * Emits rows rows of the current mask starting at the renderer's current
+ * row.
+ */
+static void
+emitMaskRows(Renderer* rdr, jint rows, jint x, jint width, jint maskWidth,
+    jint scanlineStride)
+{
+    jint rowsBeingRendered;
+
+    while (rows > 0) {
+        rowsBeingRendered = 1; //MIN(rows, NUM_ALPHA_ROWS);
+
+        rdr->_currImageOffset = rdr->_currY * scanlineStride;
+        if (rdr->_genPaint) {
+            size_t l = (width * rowsBeingRendered);
+            ALLOC3(rdr->_paint, jint, l);
+            ASSERT_ALLOC(rdr->_paint);
+            rdr->_genPaint(rdr, rowsBeingRendered);
+        }
+        rdr->_emitRows(rdr, rowsBeingRendered);
+
+        rdr->_maskOffset += maskWidth;
+        rdr->_rowNum += rowsBeingRendered;
+        rows -= rowsBeingRendered;
+        rdr->_currX = x;
+        rdr->_currY += rowsBeingRendered;
+    }
+}
+
+static void
+emitMaskRowsBand(void* ctx, jint firstRow, jint numRows) {
+    FillBands* bands = (FillBands*)ctx;
+    Renderer band;
+
+    initBandRenderer(&band, bands, firstRow);
+    // after its first row the single-threaded loop continues from x
+    if (firstRow > 0) {
+        band._currX = bands->x;
+    }
+    band._maskOffset = bands->maskOffset + firstRow * bands->maskWidth;
+    emitMaskRows(&band, numRows, bands->x, band._alphaWidth, bands->maskWidth,
+                 bands->scanlineStride);
+    my_free(band._paint);
+}
+
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask,
     jint x, jint y, jint maskWidth, jint maskHeight, jint offset, jint stride)
 {
-    jint rowsToBeRendered, rowsBeingRendered;
-
     Surface* surface;
     jobject surfaceHandle;
 
@@ -805,6 +937,7 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
         if (mask != NULL) {
             jint width = maxX - minX + 1;
             jint height = maxY - minY + 1;
+            FillBands bands;
 
             renderer_setMask(rdr, maskType, mask, maskWidth, maskHeight, JNI_FALSE);
 
@@ -823,24 +956,20 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
             rdr->_rowNum = 0;
             rdr->_maskOffset = offset;
 
-            rowsToBeRendered = height;
-
-            while (rowsToBeRendered > 0) {
-                rowsBeingRendered = 1; //MIN(rowsToBeRendered, NUM_ALPHA_ROWS);
-
-                rdr->_currImageOffset = rdr->_currY * surface->width;
-                if (rdr->_genPaint) {
-                    size_t l = (width * rowsBeingRendered);
-                    ALLOC3(rdr->_paint, jint, l);
-                    rdr->_genPaint(rdr, rowsBeingRendered);
-                }
-                rdr->_emitRows(rdr, rowsBeingRendered);
-
-                rdr->_maskOffset += maskWidth;
-                rdr->_rowNum += rowsBeingRendered;
-                rowsToBeRendered -= rowsBeingRendered;
-                rdr->_currX = x;
-                rdr->_currY += rowsBeingRendered;
+            bands.rdr = rdr;
+            bands.x_from = minX;
+            bands.x_to = maxX;
+            bands.x = x;
+            bands.y_from = minY;
+            bands.rowNum = 0;
+            bands.maskOffset = offset;
+            bands.maskWidth = maskWidth;
+            bands.scanlineStride = surface->width;
+
+            if (width * height < PARALLEL_MIN_PIXELS ||
+                !pisces_runBands(height, 1, emitMaskRowsBand, &bands))
+            {
+                emitMaskRows(rdr, height, x, width, maskWidth, surface->width);
             }
 
             renderer_removeMask(rdr);
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <PiscesParallel.h>
+#include <PiscesUtil.h>
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef CRITICAL_SECTION pisces_mutex;
+typedef CONDITION_VARIABLE pisces_cond;
+
+#define MUTEX_INIT(m)        InitializeCriticalSection(m)
+#define MUTEX_LOCK(m)        EnterCriticalSection(m)
+#define MUTEX_UNLOCK(m)      LeaveCriticalSection(m)
+#define COND_INIT(c)         InitializeConditionVariable(c)
+#define COND_WAIT(c, m)      SleepConditionVariableCS((c), (m), INFINITE)
+#define COND_SIGNAL(c)       WakeConditionVariable(c)
+#define COND_BROADCAST(c)    WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+
+typedef pthread_mutex_t pisces_mutex;
+typedef pthread_cond_t pisces_cond;
+
+#define MUTEX_INIT(m)        pthread_mutex_init((m), NULL)
+#define MUTEX_LOCK(m)        pthread_mutex_lock(m)
+#define MUTEX_UNLOCK(m)      pthread_mutex_unlock(m)
+#define COND_INIT(c)         pthread_cond_init((c), NULL)
+#define COND_WAIT(c, m)      pthread_cond_wait((c), (m))
+#define COND_SIGNAL(c)       pthread_cond_signal(c)
+#define COND_BROADCAST(c)    pthread_cond_broadcast(c)
+#endif
+
+/*
+ * More bands than threads, so that a thread that finishes early picks up
+ * another band instead of waiting for the slowest one.
+ */
+#define BANDS_PER_THREAD 2
+
+/*
+ * The pool only exists while the sw pipeline is in use and its threads run
+ * until the process exits. One fill at a time is handed out: the calling
+ * thread publishes the task, takes bands like the workers do and then
+ * waits for the last band to complete. threadCount is the number of threads
+ * a fill is split for, it can be lower than the number of threads started.
+ */
+static struct {
+    pisces_mutex lock;
+    pisces_cond workAvailable;
+    pisces_cond workDone;
+
+    jboolean initialized;
+    jint startedThreads;
+    jint threadCount;
+    jboolean busy;
+
+    PiscesBandTask *task;
+    void *ctx;
+    jint numRows;
+    jint bandRows;
+    jint numBands;
+    jint nextBand;
+    jint pendingBands;
+} pool;
+
+/*
+ * Takes the next band of the current fill and runs it. Called with the
+ * lock held, returns with the lock held.
+ */
+static jboolean runNextBand() {
+    jint band, firstRow, numRows;
+
+    if (pool.nextBand >= pool.numBands) {
+        return XNI_FALSE;
+    }
+    band = pool.nextBand++;
+    firstRow = band * pool.bandRows;
+    numRows = MIN(pool.bandRows, pool.numRows - firstRow);
+
+    MUTEX_UNLOCK(&pool.lock);
+    pool.task(pool.ctx, firstRow, numRows);
+    MUTEX_LOCK(&pool.lock);
+
+    if (--pool.pendingBands == 0) {
+        COND_SIGNAL(&pool.workDone);
+    }
+    return XNI_TRUE;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI workerMain(LPVOID arg)
+#else
+static void *workerMain(void *arg)
+#endif
+{
+    MUTEX_LOCK(&pool.lock);
+    for (;;) {
+        while (!runNextBand()) {
+            COND_WAIT(&pool.workAvailable, &pool.lock);
+        }
+    }
+    // the workers run until the process exits
+    return 0;
+}
+
+static jboolean startWorker() {
+#ifdef _WIN32
+    HANDLE thread = CreateThread(NULL, 0, workerMain, NULL, 0, NULL);
+    if (thread == NULL) {
+        return XNI_FALSE;
+    }
+    CloseHandle(thread);
+    return XNI_TRUE;
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, workerMain, NULL) != 0) {
+        return XNI_FALSE;
+    }
+    pthread_detach(thread);
+    return XNI_TRUE;
+#endif
+}
+
+void
+pisces_setThreadCount(jint threads) {
+    threads = MAX(1, MIN(threads, PISCES_MAX_THREADS));
+    if (!pool.initialized) {
+        if (threads <= 1) {
+            return;
+        }
+        MUTEX_INIT(&pool.lock);
+        COND_INIT(&pool.workAvailable);
+        COND_INIT(&pool.workDone);
+        // the calling thread takes part in every fill
+        pool.startedThreads = 1;
+        pool.initialized = XNI_TRUE;
+    }
+
+    MUTEX_LOCK(&pool.lock);
+    while (pool.startedThreads < threads && startWorker()) {
+        pool.startedThreads++;
+    }
+    pool.threadCount = MIN(threads, pool.startedThreads);
+    MUTEX_UNLOCK(&pool.lock);
+}
+
+jboolean
+pisces_runBands(jint numRows, jint rowGranularity,
+                PiscesBandTask *task, void *ctx)
+{
+    jint chunks, bands;
+
+    if (pool.threadCount <= 1 || numRows <= rowGranularity) {
+        return XNI_FALSE;
+    }
+
+    MUTEX_LOCK(&pool.lock);
+    if (pool.busy) {
+        MUTEX_UNLOCK(&pool.lock);
+        return XNI_FALSE;
+    }
+    pool.busy = XNI_TRUE;
+
+    chunks = (numRows + rowGranularity - 1) / rowGranularity;
+    bands = MIN(chunks, pool.threadCount * BANDS_PER_THREAD);
+
+    pool.task = task;
+    pool.ctx = ctx;
+    pool.numRows = numRows;
+    pool.bandRows = ((chunks + bands - 1) / bands) * rowGranularity;
+    pool.numBands = (numRows + pool.bandRows - 1) / pool.bandRows;
+    pool.nextBand = 0;
+    pool.pendingBands = pool.numBands;
+    COND_BROADCAST(&pool.workAvailable);
+
+    while (runNextBand()) {
+    }
+    while (pool.pendingBands > 0) {
+        COND_WAIT(&pool.workDone, &pool.lock);
+    }
+
+    pool.task = NULL;
+    pool.ctx = NULL;
+    pool.busy = XNI_FALSE;
+    MUTEX_UNLOCK(&pool.lock);
+    return XNI_TRUE;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @file PiscesParallel.h
+ * Splitting of large fills into bands of rows filled by a pool of worker
+ * threads.
+ */
+
+#ifndef PISCES_PARALLEL_H
+#define PISCES_PARALLEL_H
+
+#include <PiscesDefs.h>
+
+/**
+ * Upper bound for the number of threads (including the calling one) that
+ * take part in a fill.
+ */
+#define PISCES_MAX_THREADS 32
+
+/**
+ * Fills numRows rows starting at row firstRow of a band split. It is called
+ * concurrently for disjoint bands and must only write the pixels of its own
+ * rows.
+ */
+typedef void PiscesBandTask(void *ctx, jint firstRow, jint numRows);
+
+/**
+ * Sets the number of threads, including the calling one, that fills use,
+ * starting worker threads as needed. Started threads keep running when the
+ * count is lowered; 1 fills on the calling thread only.
+ */
+void pisces_setThreadCount(jint threads);
+
+/**
+ * Splits numRows rows into bands whose sizes are multiples of rowGranularity
+ * and runs task for each band on the worker threads and on the calling
+ * thread, returning once all bands are done.
+ *
+ * @return XNI_FALSE if no worker threads are available or the pool is busy
+ * with another fill, in which case nothing was run and the caller fills the
+ * rows itself
+ */
+jboolean pisces_runBands(jint numRows, jint rowGranularity,
+                         PiscesBandTask *task, void *ctx);
+
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,7 @@ import java.io.IOException;
 import java.io.InputStream;
 
 import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertNotNull;
 import static org.junit.jupiter.api.Assertions.assertTrue;
 import static org.junit.jupiter.api.Assertions.fail;
@@ -144,6 +145,94 @@ public class ImageLoaderScalingTest {
         testScale("gif", 100, 100, 100, 100);
     }
 
+    /*
+     * The JPEG decoder downscales by N/8 in the IDCT and leaves the rest to
+     * the rough scaler, so its result is compared with a full decode that is
+     * area averaged to the size the IDCT produces and then sampled like the
+     * rough scaler does. The IDCT scaling is not an exact average, a smooth
+     * image keeps the difference within a few levels.
+     */
+    private static final int MAX_DCT_SCALE_ERROR = 8;
+
+    private void testDownscaleJPG(int srcW, int srcH, int dstW, int dstH) throws Exception {
+        BufferedImage bImg = new BufferedImage(srcW, srcH, BufferedImage.TYPE_INT_RGB);
+        for (int y = 0; y < srcH; y++) {
+            for (int x = 0; x < srcW; x++) {
+                int r = x * 255 / srcW;
+                int g = y * 255 / srcH;
+                int b = (x + y) * 255 / (srcW + srcH);
+                bImg.setRGB(x, y, (r << 16) | (g << 8) | b);
+            }
+        }
+        ByteArrayInputStream in = ImageTestHelper.writeImageToStream(bImg, "jpg", null);
+        Image fullImg = loadImage(in, 0, 0);
+        in.reset();
+        Image img = loadImage(in, dstW, dstH);
+        assertEquals(dstW, img.getWidth());
+        assertEquals(dstH, img.getHeight());
+
+        // Smallest N/8 that covers the requested size, see jpegloader.c
+        int num = 1;
+        while (num < 8 && (srcW * num < dstW * 8 || srcH * num < dstH * 8)) {
+            num++;
+        }
+        int dctW = (srcW * num + 7) / 8;
+        int dctH = (srcH * num + 7) / 8;
+
+        for (int y = 0; y < dstH; y++) {
+            int dctY = (int) Math.floor((y + 0.5) * dctH / dstH);
+            for (int x = 0; x < dstW; x++) {
+                int dctX = (int) Math.floor((x + 0.5) * dctW / dstW);
+                int expected = areaAverage(fullImg,
+                        (double) dctX * srcW / dctW, (double) dctY * srcH / dctH,
+                        (double) srcW / dctW, (double) srcH / dctH);
+                int actual = img.getArgb(x, y);
+                for (int shift = 0; shift < 32; shift += 8) {
+                    int diff = Math.abs(((expected >> shift) & 0xff) - ((actual >> shift) & 0xff));
+                    if (diff > MAX_DCT_SCALE_ERROR) {
+                        fail(String.format("%dx%d to %dx%d: pixel %d, %d differs by %d; expected 0x%08X, actual 0x%08X",
+                                srcW, srcH, dstW, dstH, x, y, diff, expected, actual));
+                    }
+                }
+            }
+        }
+    }
+
+    // Averages the pixels of img covering the area [x0, x0 + w) x [y0, y0 + h)
+    private int areaAverage(Image img, double x0, double y0, double w, double h) {
+        double[] sum = new double[4];
+        double total = 0;
+        int yEnd = Math.min(img.getHeight(), (int) Math.ceil(y0 + h));
+        int xEnd = Math.min(img.getWidth(), (int) Math.ceil(x0 + w));
+        for (int y = (int) Math.floor(y0); y < yEnd; y++) {
+            double wy = Math.min(y + 1, y0 + h) - Math.max(y, y0);
+            for (int x = (int) Math.floor(x0); x < xEnd; x++) {
+                double weight = wy * (Math.min(x + 1, x0 + w) - Math.max(x, x0));
+                int argb = img.getArgb(x, y);
+                for (int c = 0; c < 4; c++) {
+                    sum[c] += weight * ((argb >> (c * 8)) & 0xff);
+                }
+                total += weight;
+            }
+        }
+        int argb = 0;
+        for (int c = 0; c < 4; c++) {
+            argb |= ((int) Math.round(sum[c] / total) & 0xff) << (c * 8);
+        }
+        return argb;
+    }
+
+    @Test
+    public void testDownscaleJPG() throws Exception {
+        testDownscaleJPG(100, 100, 50, 50);
+        testDownscaleJPG(100, 100, 25, 25);
+        testDownscaleJPG(100, 100, 13, 13);
+        testDownscaleJPG(100, 100, 88, 88);
+        testDownscaleJPG(100, 100, 38, 38);
+        testDownscaleJPG(160, 120, 60, 45);
+        testDownscaleJPG(100, 62, 37, 23);
+    }
+
     @Test
     public void testAllTheScalesPNG() throws Exception {
         testAllTheScales("png");
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.prism.sw;
+
+import com.sun.glass.utils.NativeLibLoader;
+import com.sun.pisces.GradientColorMap;
+import com.sun.pisces.JavaSurface;
+import com.sun.pisces.PiscesRenderer;
+import com.sun.pisces.RendererBase;
+import com.sun.pisces.Transform6;
+import com.sun.prism.impl.PrismSettings;
+import java.util.Random;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.EnumSource;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Checks that fills split across threads (prism.sw.threads) produce exactly
+ * the same pixels as fills on a single thread. The surface and the filled
+ * areas are larger than the 256x256 pixels below which fills are not
+ * split, and the fills start and end at fractional coordinates so that the
+ * partially covered edge rows are drawn as well.
+ */
+public class PiscesThreadsTest {
+
+    private static final int WIDTH = 613;
+    private static final int HEIGHT = 547;
+    private static final int[] THREADS = { 2, 3, 4, 7 };
+
+    private static boolean nativeAvailable;
+
+    enum Fill {
+        COLOR,
+        LINEAR_GRADIENT,
+        RADIAL_GRADIENT,
+        TEXTURE,
+        IMAGE,
+        IMAGE_MULTIPLY,
+        MASK,
+        MASK_GRADIENT,
+    }
+
+    @BeforeAll
+    static void loadLibrary() {
+        try {
+            NativeLibLoader.loadLibrary("prism_sw");
+            nativeAvailable = true;
+        } catch (LinkageError e) {
+            nativeAvailable = false;
+        }
+    }
+
+    @AfterAll
+    static void restoreThreadCount() {
+        if (nativeAvailable) {
+            PiscesRenderer.setThreadCount(PrismSettings.swThreads);
+        }
+    }
+
+    @ParameterizedTest
+    @EnumSource(Fill.class)
+    public void testSameAsSingleThread(Fill fill) {
+        assumeTrue(nativeAvailable, "prism_sw is not available");
+
+        PiscesRenderer.setThreadCount(1);
+        int[] expected = render(fill);
+        for (int threads : THREADS) {
+            PiscesRenderer.setThreadCount(threads);
+            assertArrayEquals(expected, render(fill), fill + " with " + threads + " threads");
+        }
+    }
+
+    private static int[] render(Fill fill) {
+        int[] data = background();
+        JavaSurface surface = new JavaSurface(data, RendererBase.TYPE_INT_ARGB_PRE, WIDTH, HEIGHT);
+        PiscesRenderer pr = new PiscesRenderer(surface);
+        pr.resetClip();
+        pr.setCompositeRule(RendererBase.COMPOSITE_SRC_OVER);
+
+        switch (fill) {
+            case COLOR -> {
+                pr.setColor(30, 140, 200, 180);
+                fillArea(pr);
+            }
+            case LINEAR_GRADIENT -> {
+                pr.setLinearGradient(fixed(20.5f), fixed(10.25f), fixed(580.75f), fixed(500.5f),
+                        new int[] { 0, 0x6000, 0x10000 },
+                        new int[] { 0xc0ff2000, 0x8020ff40, 0xff2040ff },
+                        GradientColorMap.CYCLE_REFLECT, null);
+                fillArea(pr);
+            }
+            case RADIAL_GRADIENT -> {
+                pr.setRadialGradient(fixed(300.5f), fixed(260.25f), fixed(250f), fixed(240.75f),
+                        fixed(90.5f),
+                        new int[] { 0, 0x4000, 0x10000 },
+                        new int[] { 0xffffff00, 0x6000a0ff, 0xe0ff00a0 },
+                        GradientColorMap.CYCLE_REPEAT, null);
+                fillArea(pr);
+            }
+            case TEXTURE -> {
+                pr.setTexture(RendererBase.TYPE_INT_ARGB_PRE, image(37, 29), 37, 29, 37,
+                        scale(2.7f, 3.1f, 5.5f, 3.25f), true, true, true);
+                fillArea(pr);
+            }
+            case IMAGE, IMAGE_MULTIPLY -> {
+                int imageMode = RendererBase.IMAGE_MODE_NORMAL;
+                if (fill == Fill.IMAGE_MULTIPLY) {
+                    imageMode = RendererBase.IMAGE_MODE_MULTIPLY;
+                    pr.setColor(255, 255, 255, 160);
+                }
+                pr.drawImage(RendererBase.TYPE_INT_ARGB_PRE, imageMode,
+                        image(53, 47), 53, 47, 0, 53,
+                        scale(10.7f, 10.9f, 15.5f, 20.25f), false, true,
+                        fixed(15.5f), fixed(20.25f), fixed(53 * 10.7f), fixed(47 * 10.9f),
+                        RendererBase.IMAGE_FRAC_EDGE_KEEP, RendererBase.IMAGE_FRAC_EDGE_KEEP,
+                        RendererBase.IMAGE_FRAC_EDGE_KEEP, RendererBase.IMAGE_FRAC_EDGE_KEEP,
+                        0, 0, 52, 46, true);
+            }
+            case MASK, MASK_GRADIENT -> {
+                if (fill == Fill.MASK) {
+                    pr.setColor(200, 60, 20, 220);
+                } else {
+                    pr.setLinearGradient(0, 0, 0xff00ff00, fixed(WIDTH), fixed(HEIGHT), 0x800000ff,
+                            GradientColorMap.CYCLE_NONE);
+                }
+                int width = 571;
+                int height = 509;
+                byte[] mask = new byte[3 + width * height];
+                new Random(7).nextBytes(mask);
+                pr.fillAlphaMask(mask, 17, 13, width, height, 3, width);
+            }
+        }
+        return data;
+    }
+
+    private static void fillArea(PiscesRenderer pr) {
+        pr.fillRect(fixed(10.3f), fixed(7.6f), fixed(590.5f), fixed(530.2f));
+    }
+
+    private static int fixed(float v) {
+        return (int) (v * (1 << 16));
+    }
+
+    private static Transform6 scale(float sx, float sy, float tx, float ty) {
+        return new Transform6(fixed(sx), 0, 0, fixed(sy), fixed(tx), fixed(ty));
+    }
+
+    private static int[] background() {
+        int[] data = new int[WIDTH * HEIGHT];
+        for (int y = 0; y < HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                data[y * WIDTH + x] = 0xff000000 | ((x & 0xff) << 16) | ((y & 0xff) << 8) | ((x ^ y) & 0xff);
+            }
+        }
+        return data;
+    }
+
+    private static int[] image(int width, int height) {
+        Random random = new Random(width * 31 + height);
+        int[] data = new int[width * height];
+        for (int i = 0; i < data.length; i++) {
+            int a = random.nextInt(256);
+            int r = random.nextInt(a + 1);
+            int g = random.nextInt(a + 1);
+            int b = random.nextInt(a + 1);
+            data[i] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+        return data;
+    }
+}
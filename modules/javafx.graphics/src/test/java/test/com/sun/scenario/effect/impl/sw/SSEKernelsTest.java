@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.scenario.effect.impl.sw;
+
+import com.sun.scenario.effect.FilterContext;
+import com.sun.scenario.effect.impl.prism.PrFilterContext;
+import com.sun.scenario.effect.impl.sw.java.JSWPeersShim;
+import com.sun.scenario.effect.impl.sw.sse.SSEPeersShim;
+import java.util.Random;
+import java.util.stream.Stream;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.MethodSource;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Checks that each set of native Decora kernels produces exactly the same
+ * pixels as the Java peers. The scalar kernels are one of the sets, so the
+ * vector kernels are also checked against them.
+ */
+public class SSEKernelsTest {
+
+    private static final int[] SIZES = { 1, 2, 3, 5, 8, 13, 17, 32, 33 };
+    private static final int[] KERNEL_SIZES = { 1, 2, 3, 7, 16, 31 };
+    private static final float[] SPREADS = { 0f, 0.3f, 0.9f };
+
+    private static FilterContext fctx;
+    private static boolean nativeKernelsAvailable;
+
+    static Stream<String> kernels() {
+        return Stream.of("avx2", "sse4.1", "neon", "scalar");
+    }
+
+    @BeforeAll
+    static void initKernels() {
+        fctx = PrFilterContext.getPrinterContext(new Object());
+        try {
+            SSEPeersShim.selectKernels(null);
+            nativeKernelsAvailable = true;
+        } catch (LinkageError e) {
+            nativeKernelsAvailable = false;
+        }
+    }
+
+    @AfterAll
+    static void restoreKernels() {
+        if (nativeKernelsAvailable) {
+            SSEPeersShim.selectKernels(System.getProperty("decora.simd.kernels"));
+        }
+    }
+
+    private static void selectKernels(String name) {
+        assumeTrue(nativeKernelsAvailable, "decora_sse is not available");
+        assumeTrue(name.equals(SSEPeersShim.selectKernels(name)),
+                   name + " kernels are not supported on this processor");
+    }
+
+    private static int[] randomPixels(Random random, int count) {
+        int[] pixels = new int[count];
+        for (int i = 0; i < count; i++) {
+            // Premultiplied, with a share of transparent and opaque pixels.
+            int a = switch (random.nextInt(4)) {
+                case 0 -> 0;
+                case 1 -> 255;
+                default -> random.nextInt(256);
+            };
+            int r = random.nextInt(a + 1);
+            int g = random.nextInt(a + 1);
+            int b = random.nextInt(a + 1);
+            pixels[i] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+        return pixels;
+    }
+
+    @ParameterizedTest
+    @MethodSource("kernels")
+    public void testBoxBlur(String name) {
+        selectKernels(name);
+        Random random = new Random(name.hashCode());
+        for (int srcw : SIZES) {
+            for (int srch : SIZES) {
+                int[] src = randomPixels(random, srcw * srch);
+                for (int ksize : KERNEL_SIZES) {
+                    String where = name + " " + srcw + "x" + srch + " k=" + ksize;
+
+                    int dstw = srcw + ksize - 1;
+                    int[] expected = new int[dstw * srch];
+                    int[] actual = new int[dstw * srch];
+                    JSWPeersShim.boxBlurHorizontal(fctx, expected, dstw, srch, dstw,
+                                                   src, srcw, srch, srcw);
+                    SSEPeersShim.boxBlurHorizontal(actual, dstw, srch, dstw,
+                                                   src, srcw, srch, srcw);
+                    assertArrayEquals(expected, actual, "horizontal " + where);
+
+                    int dsth = srch + ksize - 1;
+                    expected = new int[srcw * dsth];
+                    actual = new int[srcw * dsth];
+                    JSWPeersShim.boxBlurVertical(fctx, expected, srcw, dsth, srcw,
+                                                 src, srcw, srch, srcw);
+                    SSEPeersShim.boxBlurVertical(actual, srcw, dsth, srcw,
+                                                 src, srcw, srch, srcw);
+                    assertArrayEquals(expected, actual, "vertical " + where);
+                }
+            }
+        }
+    }
+
+    @ParameterizedTest
+    @MethodSource("kernels")
+    public void testBoxShadow(String name) {
+        selectKernels(name);
+        Random random = new Random(name.hashCode());
+        float[] shadowColor = { 0.2f, 0.4f, 0.6f, 0.8f };
+        for (int srcw : SIZES) {
+            for (int srch : SIZES) {
+                int[] src = randomPixels(random, srcw * srch);
+                for (int ksize : KERNEL_SIZES) {
+                    for (float spread : SPREADS) {
+                        String where = name + " " + srcw + "x" + srch + " k=" + ksize + " spread=" + spread;
+
+                        int dstw = srcw + ksize - 1;
+                        int[] expected = new int[dstw * srch];
+                        int[] actual = new int[dstw * srch];
+                        JSWPeersShim.boxShadowHorizontalBlack(fctx, expected, dstw, srch, dstw,
+                                                              src, srcw, srch, srcw, spread);
+                        SSEPeersShim.boxShadowHorizontalBlack(actual, dstw, srch, dstw,
+                                                              src, srcw, srch, srcw, spread);
+                        assertArrayEquals(expected, actual, "horizontal black " + where);
+
+                        int dsth = srch + ksize - 1;
+                        expected = new int[srcw * dsth];
+                        actual = new int[srcw * dsth];
+                        JSWPeersShim.boxShadowVerticalBlack(fctx, expected, srcw, dsth, srcw,
+                                                            src, srcw, srch, srcw, spread);
+                        SSEPeersShim.boxShadowVerticalBlack(actual, srcw, dsth, srcw,
+                                                            src, srcw, srch, srcw, spread);
+                        assertArrayEquals(expected, actual, "vertical black " + where);
+
+                        expected = new int[srcw * dsth];
+                        actual = new int[srcw * dsth];
+                        JSWPeersShim.boxShadowVertical(fctx, expected, srcw, dsth, srcw,
+                                                       src, srcw, srch, srcw, spread, shadowColor);
+                        SSEPeersShim.boxShadowVertical(actual, srcw, dsth, srcw,
+                                                       src, srcw, srch, srcw, spread, shadowColor);
+                        assertArrayEquals(expected, actual, "vertical " + where);
+                    }
+                }
+            }
+        }
+    }
+
+    @ParameterizedTest
+    @MethodSource("kernels")
+    public void testLinearConvolve(String name) {
+        selectKernels(name);
+        Random random = new Random(name.hashCode());
+        for (int ksize : KERNEL_SIZES) {
+            // The peers expect the normalized kernel twice in a row.
+            float[] weights = new float[ksize * 2];
+            float sum = 0f;
+            for (int i = 0; i < ksize; i++) {
+                weights[i] = random.nextFloat() + 0.01f;
+                sum += weights[i];
+            }
+            for (int i = 0; i < ksize; i++) {
+                weights[i] /= sum;
+                weights[i + ksize] = weights[i];
+            }
+            for (int srccols : SIZES) {
+                for (int srcrows : SIZES) {
+                    String where = name + " " + srccols + "x" + srcrows + " k=" + ksize;
+                    int[] src = randomPixels(random, srccols * srcrows);
+
+                    // Horizontal pass: rows are rows.
+                    int dstcols = srccols + ksize - 1;
+                    int[] expected = new int[dstcols * srcrows];
+                    int[] actual = new int[dstcols * srcrows];
+                    JSWPeersShim.linearConvolveHV(fctx, expected, dstcols, srcrows, 1, dstcols,
+                                                  src, srccols, srcrows, 1, srccols, weights);
+                    SSEPeersShim.linearConvolveHV(fctx, actual, dstcols, srcrows, 1, dstcols,
+                                                  src, srccols, srcrows, 1, srccols, weights);
+                    assertArrayEquals(expected, actual, "horizontal " + where);
+
+                    // Vertical pass: rows are the columns of the image.
+                    int dstrows = srcrows + ksize - 1;
+                    expected = new int[srccols * dstrows];
+                    actual = new int[srccols * dstrows];
+                    JSWPeersShim.linearConvolveHV(fctx, expected, dstrows, srccols, srccols, 1,
+                                                  src, srcrows, srccols, srccols, 1, weights);
+                    SSEPeersShim.linearConvolveHV(fctx, actual, dstrows, srccols, srccols, 1,
+                                                  src, srcrows, srccols, srccols, 1, weights);
+                    assertArrayEquals(expected, actual, "vertical " + where);
+                }
+            }
+        }
+    }
+}
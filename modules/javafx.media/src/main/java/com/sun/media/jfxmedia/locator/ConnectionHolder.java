@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,9 +46,13 @@ import java.util.Map;
  */
 public abstract class ConnectionHolder {
     private static int DEFAULT_BUFFER_SIZE = 4096;
+    // Size of the ring sequential sources are read ahead into, 0 disables read-ahead
+    private static final int READ_AHEAD_SIZE =
+            Math.max(0, Integer.getInteger("jfxmedia.readahead.size", 1 << 20));
 
     ReadableByteChannel channel;
     ByteBuffer          buffer = ByteBuffer.allocateDirect(DEFAULT_BUFFER_SIZE);
+    ReadAheadBuffer     readAhead;
 
     static ConnectionHolder createMemoryConnectionHolder(ByteBuffer buffer) {
         return new MemoryConnectionHolder(buffer);
@@ -131,11 +135,62 @@ public abstract class ConnectionHolder {
      */
     public abstract long seek(long position);
 
+    /**
+     * Detects whether the source may be read ahead by a background thread.
+     * Such source must be read sequentially with readNextBlock and must stop
+     * and restart read-ahead around repositioning its channel.
+     *
+     * @return true if the source supports read-ahead, false otherwise.
+     */
+    boolean canReadAhead() {
+        return false;
+    }
+
+    /**
+     * Starts reading the stream ahead into a ring buffer which native code
+     * consumes directly instead of calling readNextBlock.
+     *
+     * @return the buffer shared with native code or null if read-ahead is not used
+     */
+    ByteBuffer startReadAhead() {
+        if (READ_AHEAD_SIZE <= 0 || !canReadAhead() || null == channel) {
+            return null;
+        }
+
+        if (null == readAhead) {
+            readAhead = new ReadAheadBuffer(READ_AHEAD_SIZE);
+        }
+        readAhead.start(channel, true);
+        return readAhead.getSharedBuffer();
+    }
+
+    /**
+     * Called by native code when the read-ahead ring is empty.
+     */
+    void waitForReadAhead() {
+        if (null != readAhead) {
+            readAhead.waitForData();
+        }
+    }
+
+    /**
+     * Called by native code when it freed space in a full read-ahead ring.
+     */
+    void readAheadSpaceAvailable() {
+        if (null != readAhead) {
+            readAhead.spaceAvailable();
+        }
+    }
+
     /**
      * Closes connection when done.
      * Overriding methods should call this method in the beginning of their implementation.
      */
     public void closeConnection() {
+        if (null != readAhead) {
+            readAhead.stop();
+        }
+
         try {
             if (channel != null) {
                 channel.close();
@@ -275,8 +330,35 @@ public abstract class ConnectionHolder {
             throw new IOException();
         }
 
+        @Override
+        boolean canReadAhead() {
+            return true;
+        }
+
         @Override
         public long seek(long position) {
+            if (null == readAhead) {
+                return seekChannel(position);
+            }
+
+            // The producer is not interrupted, an interrupted read would close
+            // the stream. A successful seek closes the old connection, which
+            // ends a blocked read; after a failed one the producer finishes
+            // its current read and reading goes on from the same stream.
+            readAhead.requestStop();
+            long result = seekChannel(position);
+            readAhead.awaitStop();
+            if (null != channel && channel.isOpen()) {
+                // Keep data read ahead if seek failed
+                readAhead.start(channel, result >= 0);
+            } else {
+                // The seek closed the stream and could not reopen it
+                readAhead.stop();
+            }
+            return result;
+        }
+
+        private long seekChannel(long position) {
             if (urlConnection instanceof HttpURLConnection) {
                 URLConnection tmpURLConnection = null;
 
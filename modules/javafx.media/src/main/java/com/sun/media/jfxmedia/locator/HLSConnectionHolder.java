@@ -54,6 +54,10 @@ final class HLSConnectionHolder extends ConnectionHolder {
     private boolean isAudioExtStream = false;
     private HLSConnectionHolder audioConnectionHolder = null;
     private URLConnection urlConnection = null;
+    // Prefetched segment being read, null if segment was loaded directly
+    private HLSSegmentPrefetcher.Segment currentSegment = null;
+    private int segmentLength = -1;
+    private final HLSSegmentPrefetcher prefetcher = new HLSSegmentPrefetcher();
     private URLConnection headerConnection = null;
     private ReadableByteChannel headerChannel = null;
     private final PlaylistLoader playlistLoader;
@@ -194,11 +198,19 @@ final class HLSConnectionHolder extends ConnectionHolder {
     @Override
     public void closeConnection() {
         currentPlaylist.close();
+        prefetcher.close();
         super.closeConnection();
         resetConnection();
         playlistLoader.putState(PlaylistLoader.STATE_EXIT);
     }
 
+    /**
+     * Returns segment prefetch counters of this connection.
+     */
+    HLSSegmentPrefetcher.Statistics getPrefetchStatistics() {
+        return prefetcher.getStatistics();
+    }
+
     @Override
     int property(int prop, int value) {
         if (!isReady()) {
@@ -317,6 +329,8 @@ final class HLSConnectionHolder extends ConnectionHolder {
 
         Locator.closeConnection(urlConnection);
         urlConnection = null;
+        currentSegment = null;
+        segmentLength = -1;
     }
 
     private void resetHeaderConnection() {
@@ -379,18 +393,34 @@ final class HLSConnectionHolder extends ConnectionHolder {
             return -1;
         }
 
-        try {
-            URI uri = new URI(mediaFile);
-            urlConnection = uri.toURL().openConnection();
-            channel = openChannel();
-        } catch (IOException | URISyntaxException e) {
-            return -1;
+        currentSegment = prefetcher.take(mediaFile);
+        if (currentSegment != null) {
+            segmentLength = currentSegment.getContentLength();
+            if (segmentLength == Integer.MIN_VALUE) {
+                currentSegment = null; // Prefetch failed, try again below
+            } else {
+                channel = currentSegment.openChannel();
+            }
+        }
+
+        if (currentSegment == null) {
+            try {
+                URI uri = new URI(mediaFile);
+                urlConnection = uri.toURL().openConnection();
+                channel = openChannel();
+                segmentLength = urlConnection.getContentLength();
+            } catch (IOException | URISyntaxException e) {
+                return -1;
+            }
         }
 
+        // Let next segments download while this one is played.
+        prefetcher.prefetch(currentPlaylist.getUpcomingMediaFiles(HLSSegmentPrefetcher.LOOKAHEAD));
+
         if (currentPlaylist.isCurrentMediaFileDiscontinuity()) {
-            return (-1 * (urlConnection.getContentLength() + headerLength));
+            return (-1 * (segmentLength + headerLength));
         } else {
-            return (urlConnection.getContentLength() + headerLength);
+            return (segmentLength + headerLength);
         }
     }
 
@@ -403,7 +433,14 @@ final class HLSConnectionHolder extends ConnectionHolder {
     }
 
     private void adjustBitrate(long readTime) {
-        int avgBitrate = (int) (((long) urlConnection.getContentLength() * 8 * 1000) / readTime);
+        int avgBitrate;
+        long throughput = prefetcher.getThroughput();
+        if (currentSegment != null && throughput > 0) {
+            // Prefetched data is read almost instantly, so use download rate.
+            avgBitrate = (int) Math.min(Integer.MAX_VALUE, throughput * 8);
+        } else {
+            avgBitrate = (int) (((long) segmentLength * 8 * 1000) / Math.max(1, readTime));
+        }
 
         Playlist playlist = variantPlaylist.getPlaylistBasedOnBitrate(avgBitrate);
         if (playlist != null && playlist != currentPlaylist) {
@@ -1365,6 +1402,15 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
+        // Returns media files after current one without advancing.
+        List<String> getUpcomingMediaFiles(int count) {
+            synchronized (lock) {
+                int from = Math.min(mediaFileIndex + 1, mediaFiles.size());
+                int to = Math.min(mediaFiles.size(), from + count);
+                return new ArrayList<>(mediaFiles.subList(from, to));
+            }
+        }
+
         String getHeaderFile() {
             synchronized (lock) {
                 if (mediaFiles.size() > 0) {
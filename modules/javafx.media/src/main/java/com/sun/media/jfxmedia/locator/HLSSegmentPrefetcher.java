@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmedia.locator;
+
+import com.sun.media.jfxmedia.logging.Logger;
+import java.io.IOException;
+import java.io.InputStream;
+import java.net.URI;
+import java.net.URISyntaxException;
+import java.net.URLConnection;
+import java.nio.ByteBuffer;
+import java.nio.channels.ClosedChannelException;
+import java.nio.channels.ReadableByteChannel;
+import java.util.Arrays;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+/**
+ * Downloads upcoming HLS segments in parallel, so segment requests on high
+ * latency links overlap with playback of the current segment.
+ * <p>
+ * Number of concurrent downloads follows the ratio of time to first byte
+ * to transfer time: when latency dominates more requests are kept in flight.
+ * Downloaded data not yet consumed is bounded by bytes.
+ */
+final class HLSSegmentPrefetcher {
+    private static final int MAX_CONCURRENT_DOWNLOADS =
+            Math.max(1, Integer.getInteger("jfxmedia.hls.prefetch.concurrency", 4));
+    private static final long MAX_BUFFERED_BYTES =
+            Math.max(0L, Long.getLong("jfxmedia.hls.prefetch.bytes", 32L << 20));
+    // Number of playlist entries after current segment considered for prefetch
+    static final int LOOKAHEAD = 2 * MAX_CONCURRENT_DOWNLOADS;
+
+    private static final int READ_CHUNK_SIZE = 65536;
+    private static final double AVERAGE_WEIGHT = 0.3;
+
+    private final Map<String, Segment> segments = new LinkedHashMap<>();
+    private ExecutorService executor;
+    private boolean closed = false;
+
+    // Measurements, guarded by this
+    private int activeDownloads = 0;
+    private double averageFirstByteMillis = -1.0;
+    private double averageTransferMillis = -1.0;
+    private long averageSegmentSize = 0;
+    private long busyStartTime = 0;
+    private long busyMillis = 0;
+    private long downloadedBytes = 0;
+
+    // Buffering health
+    private long hits = 0;
+    private long misses = 0;
+    private volatile long stalls = 0;
+
+    /**
+     * Takes the segment for the given URI if it was prefetched.
+     *
+     * @return segment, possibly still downloading, or null if the caller has
+     * to load the segment itself
+     */
+    synchronized Segment take(String uri) {
+        Segment segment = segments.remove(uri);
+        if (segment == null || segment.hasFailed()) {
+            misses++;
+            return null;
+        }
+
+        hits++;
+        return segment;
+    }
+
+    /**
+     * Starts downloads for the given upcoming segments as long as concurrency
+     * and byte limits allow. Prefetched segments not in the list are dropped,
+     * which happens after seeking or switching variant playlist.
+     */
+    synchronized void prefetch(List<String> upcoming) {
+        if (closed || MAX_BUFFERED_BYTES == 0) {
+            return;
+        }
+
+        Iterator<Map.Entry<String, Segment>> it = segments.entrySet().iterator();
+        while (it.hasNext()) {
+            Map.Entry<String, Segment> entry = it.next();
+            if (!upcoming.contains(entry.getKey())) {
+                entry.getValue().cancel();
+                it.remove();
+            }
+        }
+
+        int concurrency = getConcurrency();
+        long buffered = getBufferedBytes();
+        for (String uri : upcoming) {
+            if (segments.containsKey(uri)) {
+                continue;
+            }
+
+            if (activeDownloads >= concurrency || buffered + averageSegmentSize > MAX_BUFFERED_BYTES) {
+                break;
+            }
+
+            Segment segment = new Segment(uri);
+            segments.put(uri, segment);
+            buffered += averageSegmentSize;
+            downloadStarted();
+
+            if (executor == null) {
+                executor = Executors.newCachedThreadPool(r -> {
+                    Thread thread = new Thread(r, "JFXMedia HLS Prefetch");
+                    thread.setDaemon(true);
+                    return thread;
+                });
+            }
+            executor.execute(() -> download(segment));
+        }
+    }
+
+    synchronized void close() {
+        if (Logger.canLog(Logger.DEBUG) && (hits + misses) > 0) {
+            Logger.logMsg(Logger.DEBUG, "HLSSegmentPrefetcher: " + getStatistics());
+        }
+
+        closed = true;
+        for (Segment segment : segments.values()) {
+            segment.cancel();
+        }
+        segments.clear();
+
+        if (executor != null) {
+            executor.shutdown();
+            executor = null;
+        }
+    }
+
+    /**
+     * Snapshot of the buffering counters, for diagnostics.
+     *
+     * @param hits segments the reader took from the prefetcher
+     * @param misses segments the reader had to load itself
+     * @param stalls reads that waited for a prefetched segment to download
+     * @param bufferedSegments segments prefetched but not yet taken
+     * @param bufferedBytes size of the prefetched segments not yet taken
+     * @param throughput download rate in bytes per second
+     * @param concurrency downloads currently kept in flight
+     */
+    record Statistics(long hits, long misses, long stalls, int bufferedSegments,
+                      long bufferedBytes, long throughput, int concurrency) {
+        @Override
+        public String toString() {
+            return "hits " + hits + ", misses " + misses + ", stalls " + stalls
+                    + ", buffered " + bufferedSegments + " segments / " + bufferedBytes
+                    + " bytes, throughput " + throughput + " B/s, concurrency " + concurrency;
+        }
+    }
+
+    /**
+     * Returns the current counters. They stay available after close.
+     */
+    synchronized Statistics getStatistics() {
+        return new Statistics(hits, misses, getStallCount(), getBufferedSegments(),
+                getBufferedBytes(), getThroughput(), getConcurrency());
+    }
+
+    /**
+     * Returns number of concurrent downloads to keep in flight.
+     */
+    synchronized int getConcurrency() {
+        if (averageFirstByteMillis < 0) {
+            return Math.min(2, MAX_CONCURRENT_DOWNLOADS); // Nothing measured yet
+        }
+
+        double ratio = averageFirstByteMillis / Math.max(1.0, averageTransferMillis);
+        int concurrency = 1 + (int)Math.ceil(ratio);
+        return Math.max(1, Math.min(MAX_CONCURRENT_DOWNLOADS, concurrency));
+    }
+
+    /**
+     * Returns throughput in bytes per second over time when at least one
+     * download was active, or 0 if nothing was measured yet.
+     */
+    synchronized long getThroughput() {
+        long millis = busyMillis;
+        if (activeDownloads > 0) {
+            millis += System.currentTimeMillis() - busyStartTime;
+        }
+        return millis > 0 ? (downloadedBytes * 1000) / millis : 0;
+    }
+
+    /**
+     * Returns amount of prefetched data not yet taken by the reader.
+     */
+    synchronized long getBufferedBytes() {
+        long bytes = 0;
+        for (Segment segment : segments.values()) {
+            bytes += segment.getExpectedSize(averageSegmentSize);
+        }
+        return bytes;
+    }
+
+    synchronized int getBufferedSegments() {
+        return segments.size();
+    }
+
+    long getStallCount() {
+        return stalls;
+    }
+
+    private void downloadStarted() {
+        if (activeDownloads++ == 0) {
+            busyStartTime = System.currentTimeMillis();
+        }
+    }
+
+    private synchronized void downloadFinished(Segment segment) {
+        if (--activeDownloads == 0) {
+            busyMillis += System.currentTimeMillis() - busyStartTime;
+        }
+
+        if (segment.isComplete() && segment.firstByteTime > 0) {
+            double firstByte = segment.firstByteTime - segment.startTime;
+            double transfer = segment.endTime - segment.firstByteTime;
+            averageFirstByteMillis = average(averageFirstByteMillis, firstByte);
+            averageTransferMillis = average(averageTransferMillis, transfer);
+            averageSegmentSize = averageSegmentSize == 0 ? segment.length
+                    : (long)average(averageSegmentSize, segment.length);
+        }
+    }
+
+    private synchronized void bytesDownloaded(int count) {
+        downloadedBytes += count;
+    }
+
+    private static double average(double average, double value) {
+        return average < 0 ? value : average + AVERAGE_WEIGHT * (value - average);
+    }
+
+    private void download(Segment segment) {
+        URLConnection connection = null;
+        try {
+            if (segment.isCancelled()) {
+                return;
+            }
+
+            connection = new URI(segment.uri).toURL().openConnection();
+            InputStream input = connection.getInputStream();
+            segment.connected(connection.getContentLength());
+
+            byte[] chunk = new byte[READ_CHUNK_SIZE];
+            int read;
+            while ((read = input.read(chunk)) != -1) {
+                if (!segment.append(chunk, read)) {
+                    break; // Cancelled
+                }
+                bytesDownloaded(read);
+            }
+            segment.finish(null);
+        } catch (IOException | URISyntaxException | IllegalArgumentException e) {
+            segment.finish(e instanceof IOException ? (IOException)e : new IOException(e));
+        } finally {
+            Locator.closeConnection(connection);
+            downloadFinished(segment);
+        }
+    }
+
+    /**
+     * Segment data, appended by the download thread and read through a
+     * channel which blocks until data arrives.
+     */
+    final class Segment {
+        private final String uri;
+        private final long startTime = System.currentTimeMillis();
+        private long firstByteTime = 0;
+        private long endTime = 0;
+        private byte[] data = new byte[0];
+        private int length = 0;
+        private int contentLength = -1;
+        private boolean connected = false;
+        private boolean finished = false;
+        private boolean cancelled = false;
+        private boolean complete = false;
+        private IOException error = null;
+
+        private Segment(String uri) {
+            this.uri = uri;
+        }
+
+        /**
+         * Waits until the server responded.
+         *
+         * @return content length as reported by the connection, or
+         * Integer.MIN_VALUE if the download failed
+         */
+        synchronized int getContentLength() {
+            while (!connected && !finished) {
+                try {
+                    wait();
+                } catch (InterruptedException ie) {
+                    Thread.currentThread().interrupt();
+                    return Integer.MIN_VALUE;
+                }
+            }
+            return connected ? contentLength : Integer.MIN_VALUE;
+        }
+
+        ReadableByteChannel openChannel() {
+            return new SegmentChannel();
+        }
+
+        private synchronized boolean hasFailed() {
+            return finished && error != null && length == 0;
+        }
+
+        private synchronized boolean isCancelled() {
+            return cancelled;
+        }
+
+        private synchronized boolean isComplete() {
+            return complete;
+        }
+
+        private synchronized long getExpectedSize(long defaultSize) {
+            return Math.max(length, contentLength > 0 ? contentLength : defaultSize);
+        }
+
+        private synchronized void connected(int contentLength) {
+            this.contentLength = contentLength;
+            if (contentLength > 0) {
+                data = new byte[contentLength];
+            }
+            connected = true;
+            notifyAll();
+        }
+
+        private synchronized boolean append(byte[] chunk, int count) {
+            if (cancelled) {
+                return false;
+            }
+
+            if (firstByteTime == 0) {
+                firstByteTime = System.currentTimeMillis();
+            }
+
+            if (length + count > data.length) {
+                data = Arrays.copyOf(data, Math.max(length + count, data.length * 2));
+            }
+            System.arraycopy(chunk, 0, data, length, count);
+            length += count;
+            notifyAll();
+            return true;
+        }
+
+        private synchronized void finish(IOException error) {
+            this.error = error;
+            endTime = System.currentTimeMillis();
+            complete = (error == null && !cancelled);
+            finished = true;
+            notifyAll();
+        }
+
+        private synchronized void cancel() {
+            cancelled = true;
+            notifyAll();
+        }
+
+        private final class SegmentChannel implements ReadableByteChannel {
+            private int position = 0;
+            private boolean open = true;
+
+            @Override
+            public int read(ByteBuffer dst) throws IOException {
+                synchronized (Segment.this) {
+                    if (!open) {
+                        throw new ClosedChannelException();
+                    }
+
+                    if (position >= length && !finished && !cancelled) {
+                        stalls++;
+                        do {
+                            try {
+                                Segment.this.wait();
+                            } catch (InterruptedException ie) {
+                                Thread.currentThread().interrupt();
+                                throw new ClosedChannelException();
+                            }
+                        } while (position >= length && !finished && !cancelled);
+                    }
+
+                    if (position < length) {
+                        int count = Math.min(dst.remaining(), length - position);
+                        dst.put(data, position, count);
+                        position += count;
+                        return count;
+                    }
+
+                    if (cancelled) {
+                        throw new ClosedChannelException();
+                    }
+                    if (error != null) {
+                        throw error;
+                    }
+                    return -1;
+                }
+            }
+
+            @Override
+            public boolean isOpen() {
+                synchronized (Segment.this) {
+                    return open;
+                }
+            }
+
+            @Override
+            public void close() {
+                synchronized (Segment.this) {
+                    open = false;
+                    // Reader is done, stop downloading the rest and free the data
+                    cancelled = true;
+                    data = new byte[0];
+                    Segment.this.notifyAll();
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,6 +69,11 @@ public class Locator {
      * Timeout in milliseconds to wait for connection (5 min).
      */
     private static final int CONNECTION_TIMEOUT = 300000;
+    /**
+     * Default number of video decoder threads, 0 means one per CPU core.
+     */
+    private static final int DEFAULT_DECODER_THREAD_COUNT =
+            Math.max(0, Integer.getInteger("jfxmedia.decoder.threads", 0));
     /**
      * The content type of the media content.
      */
@@ -91,6 +96,10 @@ public class Locator {
      * Mutex for connectionProperties;
      */
     private final Object propertyLock = new Object();
+    /**
+     * Number of threads used by the video decoder, 0 means one per CPU core.
+     */
+    private volatile int decoderThreadCount = DEFAULT_DECODER_THREAD_COUNT;
 
     /*
      * These variables will be initialized by constructor and used by init()
@@ -592,6 +601,27 @@ public class Locator {
         }
     }
 
+    /**
+     * Sets the number of threads the video decoder may use for this media.
+     * This method should be invoked <i>before</i> the player is created or it
+     * will have no effect. Not all platforms support threaded decoding.
+     *
+     * @param count number of threads, 0 for one thread per CPU core and 1 to
+     * disable threading.
+     */
+    public void setDecoderThreadCount(int count) {
+        decoderThreadCount = count;
+    }
+
+    /**
+     * Gets the number of threads the video decoder may use for this media.
+     *
+     * @return number of threads, 0 means one thread per CPU core.
+     */
+    public int getDecoderThreadCount() {
+        return decoderThreadCount;
+    }
+
     public ConnectionHolder createConnectionHolder() throws IOException {
         // check if it's cached
         if (null != cacheEntry) {
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmedia.locator;
+
+import com.sun.media.jfxmedia.logging.Logger;
+import java.io.IOException;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.ReadableByteChannel;
+
+/**
+ * Ring buffer filled from a channel by a background thread and drained by
+ * native code directly, so sequential sources do not need a JNI call per block.
+ * <p>
+ * The buffer starts with a header shared with native code, followed by the
+ * ring. Producer only advances the write count and consumer only advances
+ * the read count, both are total byte counts since the last reset. While the
+ * ring is full the producer sets the waiting flag and blocks until the
+ * consumer frees space and calls {@link #spaceAvailable}. Layout must match
+ * JavaInputStreamCallbacks.h.
+ */
+final class ReadAheadBuffer {
+    static final int WRITE_COUNT_OFFSET = 0;
+    static final int READ_COUNT_OFFSET = 8;
+    static final int STATE_OFFSET = 16;
+    static final int STALL_COUNT_OFFSET = 24;
+    static final int PRODUCER_WAITING_OFFSET = 32;
+    static final int HEADER_SIZE = 64;
+
+    static final long STATE_RUNNING = 0;
+    static final long STATE_EOS = 1;
+    static final long STATE_ERROR = 2;
+
+    private static final VarHandle LONG_VIEW =
+            MethodHandles.byteBufferViewVarHandle(long[].class, ByteOrder.nativeOrder());
+
+    private static final long EMPTY_WAIT_MILLIS = 10L;
+
+    private final ByteBuffer shared;
+    private final ByteBuffer ring;
+    private final int capacity;
+    private final Object lock = new Object();
+
+    private Thread producer;
+    private volatile boolean running;
+    private volatile boolean consumerWaiting;
+
+    // Statistics, written by producer thread only
+    private volatile long fullWaits;
+    private volatile long peakLevel;
+
+    ReadAheadBuffer(int capacity) {
+        this.capacity = capacity;
+        shared = ByteBuffer.allocateDirect(HEADER_SIZE + capacity).order(ByteOrder.nativeOrder());
+        ring = shared.duplicate().position(HEADER_SIZE).slice();
+    }
+
+    /**
+     * Returns the buffer handed to native code.
+     */
+    ByteBuffer getSharedBuffer() {
+        return shared;
+    }
+
+    /**
+     * Starts reading the channel into the ring.
+     * If reset is true data left from the previous position is discarded.
+     */
+    synchronized void start(ReadableByteChannel channel, boolean reset) {
+        if (running) {
+            return;
+        }
+        // A producer stopped with the channel closed under it may still be
+        // returning from its last read
+        awaitStop();
+
+        if (reset) {
+            LONG_VIEW.setVolatile(shared, WRITE_COUNT_OFFSET, 0L);
+            LONG_VIEW.setVolatile(shared, READ_COUNT_OFFSET, 0L);
+        }
+
+        // Do not restart after EOS unless position changes
+        if (reset || getState() == STATE_RUNNING) {
+            LONG_VIEW.setVolatile(shared, STATE_OFFSET, STATE_RUNNING);
+            running = true;
+            producer = new Thread(() -> produce(channel), "JFXMedia Read Ahead");
+            producer.setDaemon(true);
+            producer.start();
+        }
+    }
+
+    /**
+     * Stops the producer thread and makes the consumer get an error once the
+     * ring is drained. Data already in the ring stays available. The caller
+     * is expected to close the channel, which ends a blocked read.
+     */
+    synchronized void stop() {
+        running = false;
+        LONG_VIEW.setVolatile(shared, STATE_OFFSET, STATE_ERROR);
+        if (Logger.canLog(Logger.DEBUG)) {
+            Logger.logMsg(Logger.DEBUG, "ReadAheadBuffer: capacity " + capacity
+                    + ", level " + getLevel() + ", peak level " + peakLevel
+                    + ", consumer stalls " + getStallCount() + ", producer waits " + fullWaits);
+        }
+
+        synchronized (lock) {
+            lock.notifyAll();
+        }
+    }
+
+    /**
+     * Asks the producer thread to stop before its next read, without
+     * interrupting it, so the channel stays open. Call {@link #awaitStop}
+     * before the channel is read by anyone else or the ring is restarted.
+     */
+    synchronized void requestStop() {
+        running = false;
+        synchronized (lock) {
+            lock.notifyAll();
+        }
+    }
+
+    /**
+     * Waits for the producer thread to return after {@link #requestStop}. A
+     * read in progress completes and its data is kept, unless the channel is
+     * closed under it, which ends the read instead.
+     */
+    synchronized void awaitStop() {
+        if (producer == null) {
+            return;
+        }
+        boolean interrupted = false;
+        while (producer.isAlive()) {
+            try {
+                producer.join();
+            } catch (InterruptedException ie) {
+                interrupted = true;
+            }
+        }
+        if (interrupted) {
+            Thread.currentThread().interrupt();
+        }
+        producer = null;
+    }
+
+    /**
+     * Called by native code when the ring is empty. Returns once data is
+     * available, the stream has ended or the producer was stopped.
+     */
+    void waitForData() {
+        synchronized (lock) {
+            consumerWaiting = true;
+            try {
+                while (running && getLevel() == 0 && getState() == STATE_RUNNING) {
+                    lock.wait(EMPTY_WAIT_MILLIS);
+                }
+            } catch (InterruptedException ie) {
+                Thread.currentThread().interrupt();
+            } finally {
+                consumerWaiting = false;
+            }
+        }
+    }
+
+    /**
+     * Called by native code after it consumed data while the producer was
+     * waiting for space.
+     */
+    void spaceAvailable() {
+        synchronized (lock) {
+            lock.notifyAll();
+        }
+    }
+
+    /**
+     * Number of bytes in the ring not yet consumed by native code.
+     */
+    long getLevel() {
+        return (long)LONG_VIEW.getVolatile(shared, WRITE_COUNT_OFFSET)
+                - (long)LONG_VIEW.getVolatile(shared, READ_COUNT_OFFSET);
+    }
+
+    long getPeakLevel() {
+        return peakLevel;
+    }
+
+    /**
+     * Number of times native code found the ring empty.
+     */
+    long getStallCount() {
+        return (long)LONG_VIEW.getVolatile(shared, STALL_COUNT_OFFSET);
+    }
+
+    private long getState() {
+        return (long)LONG_VIEW.getVolatile(shared, STATE_OFFSET);
+    }
+
+    private void produce(ReadableByteChannel channel) {
+        ByteBuffer target = ring.duplicate();
+        long state = STATE_RUNNING;
+
+        try {
+            while (running) {
+                long written = (long)LONG_VIEW.getVolatile(shared, WRITE_COUNT_OFFSET);
+                long level = written - (long)LONG_VIEW.getVolatile(shared, READ_COUNT_OFFSET);
+                if (level >= capacity) {
+                    fullWaits++;
+                    waitForSpace();
+                    continue;
+                }
+
+                int offset = (int)(written % capacity);
+                int length = (int)Math.min(capacity - level, capacity - offset);
+                target.limit(offset + length).position(offset);
+
+                int read = channel.read(target);
+                if (read < 0) {
+                    state = STATE_EOS;
+                    break;
+                }
+
+                LONG_VIEW.setVolatile(shared, WRITE_COUNT_OFFSET, written + read);
+                if (level + read > peakLevel) {
+                    peakLevel = level + read;
+                }
+
+                if (consumerWaiting) {
+                    synchronized (lock) {
+                        lock.notifyAll();
+                    }
+                }
+            }
+        } catch (IOException ioex) {
+            // Stopping may close the channel under a blocked read, which is expected
+            if (running) {
+                state = STATE_ERROR;
+            }
+        } catch (InterruptedException ie) {
+            // Only interrupted if the whole process is going away
+        }
+
+        if (state != STATE_RUNNING) {
+            LONG_VIEW.setVolatile(shared, STATE_OFFSET, state);
+            synchronized (lock) {
+                lock.notifyAll();
+            }
+        }
+    }
+
+    private void waitForSpace() throws InterruptedException {
+        synchronized (lock) {
+            // Consumer stores the read count before it checks the flag, so
+            // either it sees the flag or we see the space it freed.
+            LONG_VIEW.setVolatile(shared, PRODUCER_WAITING_OFFSET, 1L);
+            try {
+                while (running && getLevel() >= capacity) {
+                    lock.wait();
+                }
+            } finally {
+                LONG_VIEW.setVolatile(shared, PRODUCER_WAITING_OFFSET, 0L);
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,13 +26,34 @@
 package com.sun.media.jfxmediaimpl;
 
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
-
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
+/**
+ * Band values are written by native code into a ring of frames in a direct
+ * buffer and copied out here when they are read, so updates do not need a
+ * JNI call. Native code sends a spectrum event only when the previous one
+ * has been consumed, which batches updates arriving faster than they are
+ * read. Layout must match JavaBandsHolder.h.
+ */
 final class NativeAudioSpectrum implements AudioSpectrum {
     private static final float[] EMPTY_FLOAT_ARRAY  = new float[0];
     public static final int      DEFAULT_THRESHOLD = -60;
     public static final int      DEFAULT_BANDS = 128;
     public static final double   DEFAULT_INTERVAL = 0.1;
 
+    private static final int WRITE_COUNT_OFFSET = 0;
+    private static final int PENDING_OFFSET = 8;
+    private static final int HEADER_SIZE = 64;
+    private static final int FRAME_HEADER_SIZE = 8;
+    private static final int RING_FRAMES = 4;
+
+    private static final VarHandle LONG_VIEW =
+            MethodHandles.byteBufferViewVarHandle(long[].class, ByteOrder.nativeOrder());
+
     /**
      * Handle to the native spectrum.
      */
@@ -41,6 +62,12 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     private float[] magnitudes = EMPTY_FLOAT_ARRAY;
     private float[] phases = EMPTY_FLOAT_ARRAY;
 
+    private ByteBuffer ring;
+    private FloatBuffer[] frames;
+    private int frameSize;
+    private long readCount;
+    private float[] scratch = EMPTY_FLOAT_ARRAY;
+
     //**************************************************************************
     //***** Constructors
     //**************************************************************************
@@ -67,18 +94,22 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     }
 
     @Override
-    public void setEnabled(boolean enabled) {
+    public synchronized void setEnabled(boolean enabled) {
+        if (enabled && ring != null) {
+            // An event may have been dropped while disabled
+            LONG_VIEW.setVolatile(ring, PENDING_OFFSET, 0L);
+        }
         nativeSetEnabled(nativeRef, enabled);
     }
 
     @Override
-    public int getBandCount() {
+    public synchronized int getBandCount() {
         // just return the current size of one of the band arrays
         return phases.length;
     }
 
     @Override
-    public void setBandCount(int bands) {
+    public synchronized void setBandCount(int bands) {
         if (bands > 1) {
             magnitudes = new float[bands];
             for (int i = 0; i < magnitudes.length; i++) {
@@ -86,7 +117,20 @@ final class NativeAudioSpectrum implements AudioSpectrum {
             }
 
             phases = new float[bands];
-            nativeSetBands(nativeRef, bands, magnitudes, phases);
+            scratch = new float[2 * bands];
+
+            frameSize = FRAME_HEADER_SIZE + 2 * bands * Float.BYTES;
+            ring = ByteBuffer.allocateDirect(HEADER_SIZE + RING_FRAMES * frameSize)
+                    .order(ByteOrder.nativeOrder());
+            frames = new FloatBuffer[RING_FRAMES];
+            for (int i = 0; i < RING_FRAMES; i++) {
+                int offset = HEADER_SIZE + i * frameSize + FRAME_HEADER_SIZE;
+                frames[i] = ring.slice(offset, 2 * bands * Float.BYTES)
+                        .order(ByteOrder.nativeOrder()).asFloatBuffer();
+            }
+            readCount = 0;
+
+            nativeSetBands(nativeRef, bands, ring);
         } else {
             magnitudes = EMPTY_FLOAT_ARRAY;
             phases = EMPTY_FLOAT_ARRAY;
@@ -124,7 +168,8 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     }
 
     @Override
-    public float[] getMagnitudes(float[] mag) {
+    public synchronized float[] getMagnitudes(float[] mag) {
+        readLatestFrame();
         int size = magnitudes.length;
         if(mag == null || mag.length < size) {
             mag = new float[size];
@@ -134,7 +179,8 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     }
 
     @Override
-    public float[] getPhases(float[] phs) {
+    public synchronized float[] getPhases(float[] phs) {
+        readLatestFrame();
         int size = phases.length;
         if(phs == null || phs.length < size) {
             phs = new float[size];
@@ -143,12 +189,48 @@ final class NativeAudioSpectrum implements AudioSpectrum {
         return phs;
     }
 
+    /**
+     * Copies the most recently published frame, if it was not read yet, and
+     * acknowledges the pending spectrum event.
+     */
+    private void readLatestFrame() {
+        if (ring == null) {
+            return;
+        }
+
+        // Clear before reading, a frame published after this sends a new event
+        LONG_VIEW.setVolatile(ring, PENDING_OFFSET, 0L);
+
+        long count = (long) LONG_VIEW.getVolatile(ring, WRITE_COUNT_OFFSET);
+        for (int attempt = 0; attempt < RING_FRAMES && count > readCount; attempt++) {
+            long frame = count - 1;
+            int slot = (int) (frame % RING_FRAMES);
+            int stampOffset = HEADER_SIZE + slot * frameSize;
+
+            long stamp = (long) LONG_VIEW.getVolatile(ring, stampOffset);
+            if (stamp == 2 * frame + 2) {
+                frames[slot].get(0, scratch);
+                VarHandle.acquireFence();
+                if ((long) LONG_VIEW.getVolatile(ring, stampOffset) == stamp) {
+                    int bands = magnitudes.length;
+                    System.arraycopy(scratch, 0, magnitudes, 0, bands);
+                    System.arraycopy(scratch, bands, phases, 0, bands);
+                    readCount = count;
+                    return;
+                }
+            }
+
+            // Frame was overwritten while we read it, try the newest one again
+            count = (long) LONG_VIEW.getVolatile(ring, WRITE_COUNT_OFFSET);
+        }
+    }
+
     //**************************************************************************
     //***** JNI methods
     //**************************************************************************
     private native boolean nativeGetEnabled(long nativeRef);
     private native void    nativeSetEnabled(long nativeRef, boolean enable);
-    private native void    nativeSetBands(long nativeRef, int bands, float[] magnitudes, float[] phases);
+    private native void    nativeSetBands(long nativeRef, int bands, ByteBuffer ring);
     private native double  nativeGetInterval(long nativeRef);
     private native void    nativeSetInterval(long nativeRef, double interval);
     private native int     nativeGetThreshold(long nativeRef);
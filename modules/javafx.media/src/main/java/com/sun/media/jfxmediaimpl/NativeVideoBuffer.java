@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,8 @@ package com.sun.media.jfxmediaimpl;
 import com.sun.media.jfxmedia.control.VideoDataBuffer;
 import com.sun.media.jfxmedia.control.VideoFormat;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Arrays;
 import java.util.concurrent.atomic.AtomicInteger;
 
 /**
@@ -37,6 +39,9 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     private long nativePeer;
     private final AtomicInteger holdCount;
     private NativeVideoBuffer cachedBGRARep;
+    // Plane memory stays mapped until the native frame is disposed, so the
+    // direct buffers wrapping it are created once and shared by all callers.
+    private final ByteBuffer[] planeBuffers = new ByteBuffer[MAX_PLANE_COUNT];
 
     private static native void nativeDisposeBuffer(long handle);
 
@@ -55,6 +60,8 @@ final class NativeVideoBuffer implements VideoDataBuffer {
 
     // This causes methods to throw an NPE if the native handle is invalid
     private static final boolean DEBUG_DISPOSED_BUFFERS = false;
+    // Must match MAX_PLANE_COUNT in VideoFrame.h
+    private static final int MAX_PLANE_COUNT = 4;
     private static final VideoBufferDisposer disposer = new VideoBufferDisposer();
 
     public static NativeVideoBuffer createVideoBuffer(long nativePeer) {
@@ -89,6 +96,10 @@ final class NativeVideoBuffer implements VideoDataBuffer {
                     cachedBGRARep = null;
                 }
 
+                synchronized (planeBuffers) {
+                    Arrays.fill(planeBuffers, null);
+                }
+
                 // last reference released, dispose and clear our native handle
                 MediaDisposer.removeResourceDisposer(nativePeer);
                 nativeDisposeBuffer(nativePeer);
@@ -112,11 +123,26 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public ByteBuffer getBufferForPlane(int plane) {
         if (0 != nativePeer) {
-            ByteBuffer buffer = nativeGetBufferForPlane(nativePeer, plane);
-            // NewDirectByteBuffer sets BIG_ENDIAN to be consistent with ByteBuffer
-            // So we need to force native order
-            buffer.order(java.nio.ByteOrder.nativeOrder());
-            return buffer;
+            if (plane < 0 || plane >= MAX_PLANE_COUNT) {
+                return null;
+            }
+
+            ByteBuffer buffer;
+            synchronized (planeBuffers) {
+                buffer = planeBuffers[plane];
+                if (null == buffer) {
+                    buffer = nativeGetBufferForPlane(nativePeer, plane);
+                    if (null == buffer) {
+                        return null;
+                    }
+                    planeBuffers[plane] = buffer;
+                }
+            }
+
+            // Callers are free to move position and limit, so hand out a view.
+            // NewDirectByteBuffer and duplicate() set BIG_ENDIAN to be consistent
+            // with ByteBuffer, so we need to force native order.
+            return buffer.duplicate().order(ByteOrder.nativeOrder());
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
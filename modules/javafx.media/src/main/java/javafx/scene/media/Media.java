@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -434,6 +434,41 @@ public final class Media {
         return source;
     }
 
+    /**
+     * Sets the number of threads the video decoder may use to decode this
+     * media. Frame and slice threaded decoding lets high resolution video use
+     * several CPU cores, at the cost of a few frames of additional decoding
+     * latency. The value only affects {@link MediaPlayer}s created after this
+     * method is called, and is ignored on platforms which decode video with
+     * a system decoder.
+     * <p>
+     * The default is taken from the {@code jfxmedia.decoder.threads} system
+     * property, or 0 if it is not set.
+     *
+     * @param count the number of threads, 0 to use one thread per CPU core or
+     * 1 to decode on a single thread
+     * @throws IllegalArgumentException if {@code count} is negative
+     * @since 28
+     */
+    public final void setDecoderThreadCount(int count) {
+        if (count < 0) {
+            throw new IllegalArgumentException("count must not be negative: " + count);
+        }
+        jfxLocator.setDecoderThreadCount(count);
+    }
+
+    /**
+     * Retrieves the number of threads the video decoder may use to decode
+     * this media.
+     *
+     * @return the number of threads, 0 means one thread per CPU core
+     * @see #setDecoderThreadCount(int)
+     * @since 28
+     */
+    public final int getDecoderThreadCount() {
+        return jfxLocator.getDecoderThreadCount();
+    }
+
     /**
      * Locator used by the jfxmedia player, MediaPlayer needs access to this
      */
@@ -97,6 +97,16 @@ enum
   PROP_MULTI_CHANNEL
 };
 
+#ifdef GSTREAMER_LITE
+enum
+{
+  SIGNAL_BANDS,
+  LAST_SIGNAL
+};
+
+static guint gst_spectrum_signals[LAST_SIGNAL] = { 0 };
+#endif // GSTREAMER_LITE
+
 #define gst_spectrum_parent_class parent_class
 G_DEFINE_TYPE (GstSpectrum, gst_spectrum, GST_TYPE_AUDIO_FILTER);
 GST_ELEMENT_REGISTER_DEFINE (spectrum, "spectrum", GST_RANK_NONE,
@@ -197,6 +207,16 @@ gst_spectrum_class_init (GstSpectrumClass * klass)
           "Send separate results for each channel",
           DEFAULT_MULTI_CHANNEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+#ifdef GSTREAMER_LITE
+  /* Emitted on the streaming thread with the averaged bands of the first
+   * channel for each interval. When a handler is connected no message is
+   * posted, so band values do not have to go through the bus. */
+  gst_spectrum_signals[SIGNAL_BANDS] =
+      g_signal_new ("bands", G_TYPE_FROM_CLASS (klass), G_SIGNAL_RUN_LAST,
+      0, NULL, NULL, NULL, G_TYPE_NONE, 5, G_TYPE_UINT64, G_TYPE_UINT64,
+      G_TYPE_UINT, G_TYPE_POINTER, G_TYPE_POINTER);
+#endif // GSTREAMER_LITE
+
   GST_DEBUG_CATEGORY_INIT (gst_spectrum_debug, "spectrum", 0,
       "audio spectrum analyser element");
 
@@ -1014,6 +1034,15 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
           gst_spectrum_prepare_message_data (spectrum, cd);
         }
 
+#ifdef GSTREAMER_LITE
+        if (g_signal_has_handler_pending (spectrum,
+                gst_spectrum_signals[SIGNAL_BANDS], 0, FALSE)) {
+          cd = &spectrum->channel_data[0];
+          g_signal_emit (spectrum, gst_spectrum_signals[SIGNAL_BANDS], 0,
+              (guint64) spectrum->message_ts, spectrum->interval, bands,
+              cd->spect_magnitude, cd->spect_phase);
+        } else {
+#endif // GSTREAMER_LITE
         m = gst_spectrum_message_new (spectrum, spectrum->message_ts,
             spectrum->interval);
 
@@ -1026,6 +1055,9 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
 #else // GSTREAMER_LITE && OSX
         gst_element_post_message (GST_ELEMENT (spectrum), m);
 #endif // GSTREAMER_LITE && OSX
+#ifdef GSTREAMER_LITE
+        }
+#endif // GSTREAMER_LITE
 #ifndef GSTREAMER_LITE
       }
 #endif // GSTREAMER_LITE
@@ -66,5 +66,10 @@
 // call av_free().
 #define USE_FREE_CONTEXT       (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(62,0,0))
 
+// avcodec_open2() serializes initialization of codecs which are not thread safe
+// internally since lock manager was deprecated in 58 and removed in 59. Before
+// that we need our own lock around it.
+#define USE_AVLIB_LOCK         (LIBAVCODEC_VERSION_INT < AV_VERSION_INT(59,0,0))
+
 #endif  /* AVDEFINES_H */
 
@@ -31,10 +31,12 @@
 #include <libavutil/frame.h>
 #endif
 
+#if USE_AVLIB_LOCK
 /***********************************************************************************
  * Static AVCodec library lock. One for all instances. Necessary for avcodec_open
  ***********************************************************************************/
 G_LOCK_DEFINE_STATIC(avlib_lock);
+#endif // USE_AVLIB_LOCK
 
 static void basedecoder_init_context_default(BaseDecoder *decoder);
 
@@ -111,7 +113,9 @@ gboolean basedecoder_open_decoder(BaseDecoder *decoder, CodecIDType id)
         return FALSE; // Can't create frame
     }
 
+#if USE_AVLIB_LOCK
     G_LOCK(avlib_lock);
+#endif // USE_AVLIB_LOCK
 
     decoder->codec = avcodec_find_decoder(id);
     result = (decoder->codec != NULL);
@@ -142,7 +146,9 @@ gboolean basedecoder_open_decoder(BaseDecoder *decoder, CodecIDType id)
         }
     }
 
+#if USE_AVLIB_LOCK
     G_UNLOCK(avlib_lock);
+#endif // USE_AVLIB_LOCK
     return result;
 }
 
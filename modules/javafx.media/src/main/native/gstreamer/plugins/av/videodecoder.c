@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,12 @@ enum
     PROP_0,
     PROP_CODEC_ID,
     PROP_IS_SUPPORTED,
+    PROP_THREAD_COUNT,
+    PROP_THREAD_TYPE,
+    PROP_DECODED_FRAMES,
+    PROP_DROPPED_FRAMES,
+    PROP_AVERAGE_LATENCY,
+    PROP_MAX_LATENCY,
 };
 
 /*
@@ -120,6 +126,14 @@ static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
 
 static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps);
+static void     videodecoder_init_context(BaseDecoder *base);
+static void     videodecoder_drain(VideoDecoder *decoder);
+
+static void     videodecoder_reset_stats(VideoDecoder *decoder);
+static void     videodecoder_clear_latency_slots(VideoDecoder *decoder);
+
+static gboolean videodecoder_setup_pool(VideoDecoder *decoder, GstCaps *caps);
+static void     videodecoder_release_pool(VideoDecoder *decoder);
 
 static void videodecoder_dispose(GObject* object);
 static void videodecoder_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
@@ -129,6 +143,7 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
 {
     GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
     GObjectClass *gobject_class = (GObjectClass*)klass;
+    BaseDecoderClass *base_class = BASEDECODER_CLASS(klass);
 
     gst_element_class_set_metadata(element_class,
                 "Videodecoder",
@@ -147,6 +162,8 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     gobject_class->set_property = videodecoder_set_property;
     gobject_class->get_property = videodecoder_get_property;
 
+    base_class->init_context = videodecoder_init_context;
+
     g_object_class_install_property (gobject_class, PROP_CODEC_ID,
         g_param_spec_int ("codec-id", "Codec ID", "Codec ID", -1, G_MAXINT, 0,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
@@ -154,6 +171,37 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     g_object_class_install_property (gobject_class, PROP_IS_SUPPORTED,
         g_param_spec_boolean ("is-supported", "Is supported", "Is codec ID supported", FALSE,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_COUNT,
+        g_param_spec_int ("thread-count", "Thread count",
+        "Number of decoding threads (0 - one per CPU core, 1 - no threading). Applied when decoder is opened.",
+        0, G_MAXINT, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_TYPE,
+        g_param_spec_int ("thread-type", "Thread type",
+        "Threading method (1 - frame, 2 - slice, 3 - frame and slice). Applied when decoder is opened.",
+        FF_THREAD_FRAME, FF_THREAD_FRAME | FF_THREAD_SLICE, FF_THREAD_FRAME | FF_THREAD_SLICE,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_DECODED_FRAMES,
+        g_param_spec_uint64 ("decoded-frames", "Decoded frames", "Number of decoded frames",
+        0, G_MAXUINT64, 0, (GParamFlags)(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_DROPPED_FRAMES,
+        g_param_spec_uint64 ("dropped-frames", "Dropped frames",
+        "Number of frames which failed to decode or could not be delivered",
+        0, G_MAXUINT64, 0, (GParamFlags)(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_AVERAGE_LATENCY,
+        g_param_spec_uint64 ("average-latency", "Average latency",
+        "Average time in microseconds from packet input to frame output",
+        0, G_MAXUINT64, 0, (GParamFlags)(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_MAX_LATENCY,
+        g_param_spec_uint64 ("max-latency", "Maximum latency",
+        "Maximum time in microseconds from packet input to frame output",
+        0, G_MAXUINT64, 0, (GParamFlags)(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
 }
 
 static void videodecoder_init(VideoDecoder *decoder)
@@ -170,10 +218,14 @@ static void videodecoder_init(VideoDecoder *decoder)
     base->srcpad = gst_pad_new_from_static_template(&source_template, "src");
     gst_pad_use_fixed_caps(base->srcpad);
     gst_element_add_pad(GST_ELEMENT(decoder), base->srcpad);
+
+    videodecoder_clear_latency_slots(decoder);
 }
 
 void videodecoder_close_decoder(VideoDecoder *decoder)
 {
+    videodecoder_release_pool(decoder);
+
 #if HEVC_SUPPORT
     if (decoder->dest_frame)
     {
@@ -200,6 +252,7 @@ static void videodecoder_dispose(GObject* object)
     VideoDecoder *decoder = VIDEODECODER(object);
 
     basedecoder_close_decoder(BASEDECODER(decoder));
+    videodecoder_release_pool(decoder);
 
     G_OBJECT_CLASS(parent_class)->dispose(object);
 }
@@ -234,6 +287,12 @@ static void videodecoder_set_property(GObject *object, guint property_id, const
     case PROP_CODEC_ID:
         decoder->codec_id = g_value_get_int(value);
         break;
+    case PROP_THREAD_COUNT:
+        decoder->thread_count = g_value_get_int(value);
+        break;
+    case PROP_THREAD_TYPE:
+        decoder->thread_type = g_value_get_int(value);
+        break;
     default:
         break;
     }
@@ -249,6 +308,32 @@ static void videodecoder_get_property(GObject *object, guint property_id, GValue
         is_supported = videodecoder_is_decoder_by_codec_id_supported(decoder->codec_id);
         g_value_set_boolean(value, is_supported);
         break;
+    case PROP_THREAD_COUNT:
+        g_value_set_int(value, decoder->thread_count);
+        break;
+    case PROP_THREAD_TYPE:
+        g_value_set_int(value, decoder->thread_type);
+        break;
+    case PROP_DECODED_FRAMES:
+        GST_OBJECT_LOCK(decoder);
+        g_value_set_uint64(value, decoder->decoded_frames);
+        GST_OBJECT_UNLOCK(decoder);
+        break;
+    case PROP_DROPPED_FRAMES:
+        GST_OBJECT_LOCK(decoder);
+        g_value_set_uint64(value, decoder->dropped_frames);
+        GST_OBJECT_UNLOCK(decoder);
+        break;
+    case PROP_AVERAGE_LATENCY:
+        GST_OBJECT_LOCK(decoder);
+        g_value_set_uint64(value, decoder->timed_frames > 0 ? decoder->total_latency / decoder->timed_frames : 0);
+        GST_OBJECT_UNLOCK(decoder);
+        break;
+    case PROP_MAX_LATENCY:
+        GST_OBJECT_LOCK(decoder);
+        g_value_set_uint64(value, decoder->max_latency);
+        GST_OBJECT_UNLOCK(decoder);
+        break;
     default:
         break;
     }
@@ -270,6 +355,7 @@ videodecoder_change_state(GstElement* element, GstStateChange transition)
         case GST_STATE_CHANGE_READY_TO_PAUSED:
             // Clear the VideoDecoder state.
             videodecoder_state_reset(decoder);
+            videodecoder_reset_stats(decoder);
             break;
         default:
             break;
@@ -283,7 +369,13 @@ videodecoder_change_state(GstElement* element, GstStateChange transition)
     switch (transition)
     {
         case GST_STATE_CHANGE_PAUSED_TO_READY:
+            GST_INFO_OBJECT(decoder, "Decoded %" G_GUINT64_FORMAT " frames, dropped %" G_GUINT64_FORMAT
+                            ", latency average %" G_GUINT64_FORMAT " us, max %" G_GUINT64_FORMAT " us",
+                            decoder->decoded_frames, decoder->dropped_frames,
+                            decoder->timed_frames > 0 ? decoder->total_latency / decoder->timed_frames : 0,
+                            decoder->max_latency);
             basedecoder_close_decoder(BASEDECODER(decoder));
+            videodecoder_release_pool(decoder);
             break;
         default:
             break;
@@ -316,6 +408,10 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
             BASEDECODER(decoder)->is_flushing = FALSE;
             break;
 
+        case GST_EVENT_EOS:
+            videodecoder_drain(decoder);
+            break;
+
         case GST_EVENT_CAPS:
         {
             GstCaps *caps;
@@ -367,6 +463,7 @@ static void videodecoder_init_state(VideoDecoder *decoder)
     decoder->uv_blocksize = 0;
     decoder->frame_size = 0;
     decoder->discont = FALSE;
+    decoder->duration = GST_CLOCK_TIME_NONE;
     decoder->codec_id = JFX_CODEC_ID_UNKNOWN;
 #if HEVC_SUPPORT
     decoder->sws_context = NULL;
@@ -442,6 +539,31 @@ static void videodecoder_state_reset(VideoDecoder *decoder)
 {
     decoder->frame_finished = 1;
     basedecoder_flush(BASEDECODER(decoder));
+    videodecoder_clear_latency_slots(decoder);
+}
+
+static gint videodecoder_get_thread_count(VideoDecoder *decoder)
+{
+    if (decoder->thread_count > 0)
+        return decoder->thread_count;
+
+    return (gint)MIN(g_get_num_processors(), VIDEODECODER_MAX_AUTO_THREADS);
+}
+
+static void videodecoder_init_context(BaseDecoder *base)
+{
+    VideoDecoder *decoder = VIDEODECODER(base);
+
+    BASEDECODER_CLASS(parent_class)->init_context(base);
+
+    // Frame threading decodes several frames in parallel and scales with number
+    // of cores for any stream, but delays output by one frame per thread. Slice
+    // threading does not add delay, but only helps multi-slice streams.
+    base->context->thread_count = videodecoder_get_thread_count(decoder);
+    base->context->thread_type = decoder->thread_type;
+
+    GST_INFO_OBJECT(decoder, "Decoder threads: %d, thread type: %d",
+                    base->context->thread_count, base->context->thread_type);
 }
 
 #if HEVC_SUPPORT
@@ -662,6 +784,10 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
 
             return FALSE;
         }
+
+        // Failure is not fatal, push_frame() falls back to plain allocations.
+        videodecoder_setup_pool(decoder, src_caps);
+
         gst_caps_unref(src_caps);
     }
 
@@ -671,17 +797,166 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     return TRUE;
 }
 /***********************************************************************************
- * chain
+ * Output buffer pool
  ***********************************************************************************/
-static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+// Uses pool proposed by downstream in ALLOCATION query or creates our own one.
+// Buffers return to the pool once the last reference is dropped, which is
+// usually when Java side disposes the video frame, so at steady state no
+// frame sized allocations are done per decoded frame.
+static gboolean videodecoder_setup_pool(VideoDecoder *decoder, GstCaps *caps)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstBufferPool *pool = NULL;
+    GstStructure  *config = NULL;
+    guint          size = decoder->frame_size;
+    guint          min_buffers = VIDEODECODER_POOL_MIN_BUFFERS;
+
+    videodecoder_release_pool(decoder);
+
+    GstQuery *query = gst_query_new_allocation(caps, TRUE);
+    if (query != NULL)
+    {
+        if (gst_pad_peer_query(base->srcpad, query) &&
+            gst_query_get_n_allocation_pools(query) > 0)
+        {
+            guint max_buffers = 0;
+            gst_query_parse_nth_allocation_pool(query, 0, &pool, &size, &min_buffers, &max_buffers);
+            size = MAX(size, decoder->frame_size);
+            min_buffers = MAX(min_buffers, VIDEODECODER_POOL_MIN_BUFFERS);
+        }
+        gst_query_unref(query);
+    }
+
+    if (pool == NULL)
+        pool = gst_buffer_pool_new();
+    if (pool == NULL)
+        return FALSE;
+
+    config = gst_buffer_pool_get_config(pool);
+    // Unlimited maximum. Frames held by renderer must never stall decoding.
+    gst_buffer_pool_config_set_params(config, caps, size, min_buffers, 0);
+    if (!gst_buffer_pool_set_config(pool, config) || !gst_buffer_pool_set_active(pool, TRUE))
+    {
+        GST_WARNING_OBJECT(decoder, "Failed to configure output buffer pool");
+        gst_object_unref(pool);
+        return FALSE;
+    }
+
+    decoder->pool = pool;
+    return TRUE;
+}
+
+static void videodecoder_release_pool(VideoDecoder *decoder)
+{
+    if (decoder->pool)
+    {
+        // Buffers still owned by downstream are freed when they are released.
+        gst_buffer_pool_set_active(decoder->pool, FALSE);
+        gst_object_unref(decoder->pool);
+        decoder->pool = NULL;
+    }
+}
+
+static GstBuffer* videodecoder_alloc_buffer(VideoDecoder *decoder)
+{
+    GstBuffer *buffer = NULL;
+
+    if (decoder->pool != NULL &&
+        gst_buffer_pool_acquire_buffer(decoder->pool, &buffer, NULL) == GST_FLOW_OK)
+    {
+        // Pooled buffers keep the size they had when released.
+        gst_buffer_set_size(buffer, decoder->frame_size);
+        return buffer;
+    }
+
+    return gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+}
+
+/***********************************************************************************
+ * Statistics
+ ***********************************************************************************/
+static void videodecoder_reset_stats(VideoDecoder *decoder)
+{
+    GST_OBJECT_LOCK(decoder);
+    decoder->decoded_frames = 0;
+    decoder->dropped_frames = 0;
+    decoder->timed_frames = 0;
+    decoder->total_latency = 0;
+    decoder->max_latency = 0;
+    GST_OBJECT_UNLOCK(decoder);
+}
+
+static void videodecoder_clear_latency_slots(VideoDecoder *decoder)
+{
+    int i;
+
+    for (i = 0; i < VIDEODECODER_LATENCY_SLOTS; i++)
+        decoder->latency_slots[i].pts = AV_NOPTS_VALUE;
+    decoder->latency_index = 0;
+}
+
+// Remembers when packet with given PTS was sent to decoder. With frame threading
+// and B-frames output is delayed by several packets, so latency is measured
+// from submit of packet to output of frame with same PTS.
+static void videodecoder_submit_packet(VideoDecoder *decoder, int64_t pts)
+{
+    if (pts == AV_NOPTS_VALUE)
+        return;
+
+    DecodeTimestamp *slot = &decoder->latency_slots[decoder->latency_index];
+    slot->pts = pts;
+    slot->submit_time = g_get_monotonic_time();
+    decoder->latency_index = (decoder->latency_index + 1) % VIDEODECODER_LATENCY_SLOTS;
+}
+
+static void videodecoder_frame_decoded(VideoDecoder *decoder, int64_t pts)
+{
+    gboolean timed = FALSE;
+    guint64 latency = 0;
+    int i;
+
+    if (pts != AV_NOPTS_VALUE)
+    {
+        for (i = 0; i < VIDEODECODER_LATENCY_SLOTS; i++)
+        {
+            if (decoder->latency_slots[i].pts == pts)
+            {
+                latency = (guint64)(g_get_monotonic_time() - decoder->latency_slots[i].submit_time);
+                decoder->latency_slots[i].pts = AV_NOPTS_VALUE;
+                timed = TRUE;
+                break;
+            }
+        }
+    }
+
+    GST_OBJECT_LOCK(decoder);
+    decoder->decoded_frames++;
+    if (timed)
+    {
+        decoder->timed_frames++;
+        decoder->total_latency += latency;
+        if (latency > decoder->max_latency)
+            decoder->max_latency = latency;
+    }
+    GST_OBJECT_UNLOCK(decoder);
+}
+
+static void videodecoder_frame_dropped(VideoDecoder *decoder)
+{
+    GST_OBJECT_LOCK(decoder);
+    decoder->dropped_frames++;
+    GST_OBJECT_UNLOCK(decoder);
+}
+
+/***********************************************************************************
+ * Frame output
+ ***********************************************************************************/
+// Copies decoded frame from base->frame to new buffer and pushes it downstream.
+static GstFlowReturn videodecoder_push_frame(VideoDecoder *decoder, gboolean discont)
 {
-    VideoDecoder  *decoder = VIDEODECODER(parent);
     BaseDecoder   *base = BASEDECODER(decoder);
     GstFlowReturn  result = GST_FLOW_OK;
-    int            num_dec = NO_DATA_USED;
-    GstMapInfo     info;
     GstMapInfo     info2;
-    gboolean       unmap_buf = FALSE;
     gboolean       set_frame_values = TRUE;
     int64_t        pts = AV_NOPTS_VALUE;
     unsigned int   out_buf_size = 0;
@@ -690,6 +965,228 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     uint8_t*       data1 = NULL;
     uint8_t*       data2 = NULL;
 
+#if NO_REORDERED_OPAQUE
+    videodecoder_frame_decoded(decoder, base->frame->pts);
+#else // NO_REORDERED_OPAQUE
+    videodecoder_frame_decoded(decoder, base->frame->reordered_opaque);
+#endif // NO_REORDERED_OPAQUE
+
+    if (!videodecoder_configure_sourcepad(decoder))
+        return GST_FLOW_ERROR;
+
+#if HEVC_SUPPORT
+    // Check to see if we need to convert frame to YUV420p
+    if (base->frame->format != AV_PIX_FMT_YUV420P)
+    {
+        if (!videodecoder_convert_frame(decoder))
+        {
+            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                     GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                     g_strdup("Video frame conversion failed"), NULL,
+                                     ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+            videodecoder_frame_dropped(decoder);
+            return GST_FLOW_ERROR;
+        }
+
+#if NO_REORDERED_OPAQUE
+        pts = decoder->dest_frame->pts;
+#else // NO_REORDERED_OPAQUE
+        pts = decoder->dest_frame->reordered_opaque;
+#endif // NO_REORDERED_OPAQUE
+        data0 = decoder->dest_frame->data[0];
+        data1 = decoder->dest_frame->data[1];
+        data2 = decoder->dest_frame->data[2];
+        set_frame_values = FALSE;
+    }
+#endif // HEVC_SUPPORT
+
+    if (set_frame_values)
+    {
+#if NO_REORDERED_OPAQUE
+        pts = base->frame->pts;
+#else // NO_REORDERED_OPAQUE
+        pts = base->frame->reordered_opaque;
+#endif // NO_REORDERED_OPAQUE
+        data0 = base->frame->data[0];
+        data1 = base->frame->data[1];
+        data2 = base->frame->data[2];
+    }
+
+    GstBuffer *outbuf = videodecoder_alloc_buffer(decoder);
+    if (outbuf == NULL)
+    {
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                 GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                 g_strdup("Decoded video buffer allocation failed"), NULL,
+                                 ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        videodecoder_frame_dropped(decoder);
+        return GST_FLOW_OK;
+    }
+
+#if USE_FRAME_NUM
+    GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
+#else // USE_FRAME_NUM
+    GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
+#endif // USE_FRAME_NUM
+    if (pts != AV_NOPTS_VALUE)
+    {
+        GST_BUFFER_TIMESTAMP(outbuf) = pts;
+        GST_BUFFER_DURATION(outbuf) = decoder->duration; // Duration for video usually same
+    }
+
+    if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
+    {
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        videodecoder_frame_dropped(decoder);
+        return GST_FLOW_OK;
+    }
+
+    // Copy image by parts from different arrays.
+    if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
+    {
+        gst_buffer_unmap(outbuf, &info2);
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        videodecoder_frame_dropped(decoder);
+        return GST_FLOW_OK;
+    }
+
+    out_buf_size = decoder->frame_size;
+    if (out_buf_size >= decoder->u_offset)
+    {
+        memcpy(info2.data, data0, decoder->u_offset);
+        out_buf_size -= decoder->u_offset;
+        if (out_buf_size >= decoder->uv_blocksize &&
+            decoder->uv_blocksize <= decoder->frame_size &&
+            decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
+        {
+            memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
+            out_buf_size -= decoder->uv_blocksize;
+            if (out_buf_size >= decoder->uv_blocksize &&
+                decoder->uv_blocksize <= decoder->frame_size &&
+                decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+            {
+                memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
+            }
+            else
+            {
+                copy_error = TRUE;
+            }
+        }
+        else
+        {
+            copy_error = TRUE;
+        }
+    }
+    else
+    {
+        copy_error = TRUE;
+    }
+
+    gst_buffer_unmap(outbuf, &info2);
+
+    if (copy_error)
+    {
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        videodecoder_frame_dropped(decoder);
+        return GST_FLOW_OK;
+    }
+
+    GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
+
+    if (decoder->discont || discont)
+    {
+#ifdef DEBUG_OUTPUT
+        g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
+#endif
+        GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
+        decoder->discont = FALSE;
+    }
+
+#ifdef VERBOSE_DEBUG
+    g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
+        GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
+        GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
+#endif
+    result = gst_pad_push(base->srcpad, outbuf);
+#ifdef VERBOSE_DEBUG
+    g_print(" done, res=%s\n", gst_flow_get_name(result));
+#endif
+
+    return result;
+}
+
+#if USE_SEND_RECEIVE
+// With frame threading one packet can complete zero, one or several frames,
+// so push everything decoder has ready.
+static GstFlowReturn videodecoder_receive_frames(VideoDecoder *decoder, gboolean discont)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+
+    while (result == GST_FLOW_OK && avcodec_receive_frame(base->context, base->frame) == 0)
+    {
+        result = videodecoder_push_frame(decoder, discont);
+        discont = FALSE;
+    }
+
+    return result;
+}
+#endif // USE_SEND_RECEIVE
+
+// Pushes frames which are still inside decoder at EOS. Frame threads and
+// B-frame reordering keep several frames back, without draining they are lost.
+static void videodecoder_drain(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+
+    if (!base->is_initialized || base->context == NULL || base->is_flushing)
+        return;
+
+#if USE_SEND_RECEIVE
+    if (avcodec_send_packet(base->context, NULL) == 0)
+        videodecoder_receive_frames(decoder, FALSE);
+#else // USE_SEND_RECEIVE
+    GstFlowReturn result = GST_FLOW_OK;
+
+    av_init_packet(&decoder->packet);
+    decoder->packet.data = NULL;
+    decoder->packet.size = 0;
+    while (result == GST_FLOW_OK)
+    {
+        decoder->frame_finished = 0;
+        if (avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet) < 0 ||
+            decoder->frame_finished == 0)
+            break;
+        result = videodecoder_push_frame(decoder, FALSE);
+    }
+#endif // USE_SEND_RECEIVE
+
+    // Decoder does not accept new data after drain until flushed.
+    videodecoder_state_reset(decoder);
+}
+
+/***********************************************************************************
+ * chain
+ ***********************************************************************************/
+static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+{
+    VideoDecoder  *decoder = VIDEODECODER(parent);
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    int            num_dec = NO_DATA_USED;
+    GstMapInfo     info;
+    gboolean       unmap_buf = FALSE;
+    int64_t        pts = AV_NOPTS_VALUE;
+
     if (base->is_flushing)  // Reject buffers in flushing state.
     {
         result = GST_FLOW_FLUSHING;
@@ -710,32 +1207,24 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 
     unmap_buf = TRUE;
 
+    if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
+        pts = (int64_t)GST_BUFFER_TIMESTAMP(buf);
+    decoder->duration = GST_BUFFER_DURATION(buf);
+
+    videodecoder_submit_packet(decoder, pts);
+
     if (!base->is_hls)
     {
         if (av_new_packet(&decoder->packet, info.size) == 0)
         {
             memcpy(decoder->packet.data, info.data, info.size);
 #if NO_REORDERED_OPAQUE
-            if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-                decoder->packet.pts = (int64_t)GST_BUFFER_TIMESTAMP(buf);
-            else
-                decoder->packet.pts = AV_NOPTS_VALUE;
+            decoder->packet.pts = pts;
 #else // NO_REORDERED_OPAQUE
-            if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-                base->context->reordered_opaque = GST_BUFFER_TIMESTAMP(buf);
-            else
-                base->context->reordered_opaque = AV_NOPTS_VALUE;
+            base->context->reordered_opaque = pts;
 #endif // NO_REORDERED_OPAQUE
 #if USE_SEND_RECEIVE
             num_dec = avcodec_send_packet(base->context, &decoder->packet);
-            if (num_dec == 0)
-            {
-                num_dec = avcodec_receive_frame(base->context, base->frame);
-                if (num_dec == 0)
-                    decoder->frame_finished = 1;
-                else
-                    decoder->frame_finished = 0;
-            }
 #else
             num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet);
 #endif
@@ -758,27 +1247,13 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
         decoder->packet.data = info.data;
         decoder->packet.size = info.size;
 #if NO_REORDERED_OPAQUE
-        if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-            decoder->packet.pts = (int64_t)GST_BUFFER_TIMESTAMP(buf);
-        else
-            decoder->packet.pts = AV_NOPTS_VALUE;
+        decoder->packet.pts = pts;
 #else // NO_REORDERED_OPAQUE
-        if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-            base->context->reordered_opaque = GST_BUFFER_TIMESTAMP(buf);
-        else
-            base->context->reordered_opaque = AV_NOPTS_VALUE;
+        base->context->reordered_opaque = pts;
 #endif // NO_REORDERED_OPAQUE
 
 #if USE_SEND_RECEIVE
         num_dec = avcodec_send_packet(base->context, &decoder->packet);
-        if (num_dec == 0)
-        {
-            num_dec = avcodec_receive_frame(base->context, base->frame);
-            if (num_dec == 0)
-                decoder->frame_finished = 1;
-            else
-                decoder->frame_finished = 0;
-        }
 #else
         num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet);
 #endif
@@ -790,165 +1265,16 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 #ifdef DEBUG_OUTPUT
         g_print ("videodecoder_chain error: %s\n", avelement_error_to_string(AVELEMENT(decoder), num_dec));
 #endif
+        videodecoder_frame_dropped(decoder);
         goto _exit;
     }
 
+#if USE_SEND_RECEIVE
+    result = videodecoder_receive_frames(decoder, GST_BUFFER_IS_DISCONT(buf));
+#else // USE_SEND_RECEIVE
     if (decoder->frame_finished > 0)
-    {
-        if (!videodecoder_configure_sourcepad(decoder))
-            result = GST_FLOW_ERROR;
-        else
-        {
-#if HEVC_SUPPORT
-            // Check to see if we need to convert frame to YUV420p
-            if (base->frame->format != AV_PIX_FMT_YUV420P)
-            {
-                if (!videodecoder_convert_frame(decoder))
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Video frame conversion failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-
-                    result = GST_FLOW_ERROR;
-                    goto _exit;
-                }
-
-#if NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = decoder->dest_frame->data[0];
-                data1 = decoder->dest_frame->data[1];
-                data2 = decoder->dest_frame->data[2];
-                set_frame_values = FALSE;
-            }
-#endif // HEVC_SUPPORTf
-
-            if (set_frame_values)
-            {
-#if NO_REORDERED_OPAQUE
-                pts = base->frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = base->frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = base->frame->data[0];
-                data1 = base->frame->data[1];
-                data2 = base->frame->data[2];
-            }
-
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
-            if (outbuf == NULL)
-            {
-                if (result != GST_FLOW_FLUSHING)
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Decoded video buffer allocation failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-                }
-            }
-            else
-            {
-#if USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
-#else // USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
-#endif // USE_FRAME_NUM
-                if (pts != AV_NOPTS_VALUE)
-                {
-                    GST_BUFFER_TIMESTAMP(outbuf) = pts;
-                    GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf); // Duration for video usually same
-                }
-
-                if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                // Copy image by parts from different arrays.
-                if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
-                {
-                    gst_buffer_unmap(outbuf, &info2);
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                out_buf_size = decoder->frame_size;
-                if (out_buf_size >= decoder->u_offset)
-                {
-                    memcpy(info2.data, data0, decoder->u_offset);
-                    out_buf_size -= decoder->u_offset;
-                    if (out_buf_size >= decoder->uv_blocksize &&
-                        decoder->uv_blocksize <= decoder->frame_size &&
-                        decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                    {
-                        memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
-                        out_buf_size -= decoder->uv_blocksize;
-                        if (out_buf_size >= decoder->uv_blocksize &&
-                            decoder->uv_blocksize <= decoder->frame_size &&
-                            decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                        {
-                            memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
-                        }
-                        else
-                        {
-                            copy_error = TRUE;
-                        }
-                    }
-                    else
-                    {
-                        copy_error = TRUE;
-                    }
-                }
-                else
-                {
-                    copy_error = TRUE;
-                }
-
-                gst_buffer_unmap(outbuf, &info2);
-
-                if (copy_error)
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
-
-                if (decoder->discont || GST_BUFFER_IS_DISCONT(buf))
-                {
-#ifdef DEBUG_OUTPUT
-                    g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
-#endif
-                    GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
-                    decoder->discont = FALSE;
-                }
-
-
-#ifdef VERBOSE_DEBUG
-                g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
-                    GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
-                    GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
-#endif
-                result = gst_pad_push(base->srcpad, outbuf);
-#ifdef VERBOSE_DEBUG
-                g_print(" done, res=%s\n", gst_flow_get_name(result));
-#endif
-            }
-        }
-    }
+        result = videodecoder_push_frame(decoder, GST_BUFFER_IS_DISCONT(buf));
+#endif // USE_SEND_RECEIVE
 
 _exit:
     if (unmap_buf)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,17 @@ G_BEGIN_DECLS
 
 #define AV_VIDEO_DECODER_PLUGIN_NAME "avvideodecoder"
 
+// Upper limit for automatic thread count. More threads do not make H.264 or
+// H.265 decoding faster, but each frame thread adds one frame of latency.
+#define VIDEODECODER_MAX_AUTO_THREADS 16
+
+// Number of in-flight packets tracked for decode latency statistics.
+#define VIDEODECODER_LATENCY_SLOTS    64
+
+// Number of output buffers preallocated in the frame pool. The pool grows
+// beyond that if downstream holds more frames, it never blocks the decoder.
+#define VIDEODECODER_POOL_MIN_BUFFERS 4
+
 #if HEVC_SUPPORT
 // libswscale APIs
 typedef struct SwsContext *(*sws_getContext_ptr)(int srcW, int srcH,
@@ -64,6 +75,12 @@ typedef int (*sws_scale_ptr)(struct SwsContext *c, const uint8_t *const srcSlice
 typedef struct _VideoDecoder      VideoDecoder;
 typedef struct _VideoDecoderClass VideoDecoderClass;
 
+typedef struct _DecodeTimestamp
+{
+    int64_t pts;         // packet PTS, AV_NOPTS_VALUE if slot is free
+    gint64  submit_time; // monotonic time when packet was sent to decoder
+} DecodeTimestamp;
+
 struct _VideoDecoder {
     BaseDecoder parent;
 
@@ -77,10 +94,25 @@ struct _VideoDecoder {
     unsigned int v_offset;
     unsigned int uv_blocksize;
 
+    GstBufferPool *pool;         // recycles output buffers, configured for frame_size
+
     AVPacket     packet;
+    GstClockTime duration;       // duration of last input buffer
 
     gint         codec_id;
 
+    gint         thread_count;   // 0 - one thread per CPU core, 1 - no threading
+    gint         thread_type;    // FF_THREAD_FRAME and/or FF_THREAD_SLICE
+
+    // Statistics. Protected by object lock.
+    guint64      decoded_frames;
+    guint64      dropped_frames;
+    guint64      timed_frames;   // frames with known decode latency
+    guint64      total_latency;  // in microseconds
+    guint64      max_latency;    // in microseconds
+    DecodeTimestamp latency_slots[VIDEODECODER_LATENCY_SLOTS];
+    guint        latency_index;
+
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
     AVFrame           *dest_frame;
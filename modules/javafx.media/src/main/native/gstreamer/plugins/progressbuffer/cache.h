@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,11 +30,17 @@
 
 typedef struct _Cache Cache;
 
+// Amount of recently used data kept in memory before it is moved to the file.
+#define CACHE_DEFAULT_MEMORY_SIZE (8 * 1024 * 1024)
+
 void      cache_static_init(void); // Must be called only once from the ProgressBuffer class initializer
 
 Cache*    create_cache();
 void      destroy_cache(Cache* instance);
 
+// Sets how much data cache may keep in memory. Ignored if not supported by the platform.
+void           cache_set_memory_limit(Cache* cache, guint64 size);
+
 // Writes a buffer.
 void           cache_write_buffer(Cache* cache, GstBuffer* buffer);
 
@@ -51,6 +57,11 @@ gint64         cache_read_buffer(Cache* cache, GstBuffer** buffer);
  */
 GstFlowReturn  cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer);
 
+/* Same as cache_read_buffer_from_position(), but leaves read position intact,
+ * so several readers may use the cache at once.
+ */
+GstFlowReturn  cache_read_buffer_at(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer);
+
 // Sets a new write position
 gboolean       cache_set_write_position(Cache* cache, gint64 position);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,22 +26,339 @@
 #include <cache.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <errno.h>
+#include <string.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
+
+// Cached data is kept in fixed size chunks. Chunks close to the position
+// readers are at stay in memory, the others are written to the temporary
+// file and mapped back when they are read again. Buffers handed out to readers
+// wrap chunk memory, so data is never copied on the way out.
+#define CHUNK_SHIFT         20
+#define CHUNK_SIZE          (1 << CHUNK_SHIFT)
+#define CHUNK_MASK          (CHUNK_SIZE - 1)
+#define MAX_MAPPED_CHUNKS   64 // Limits address space taken by file mappings
+#define NO_FILE_SLOT        (-1)
+
 static const char *tempDir = NULL;
 
+typedef struct _CacheBlock
+{
+    gint     refcount;      // cache and every buffer wrapping the block hold a reference
+    guint8  *data;
+    gboolean mapped;        // mmap()ed from the file, otherwise allocated
+} CacheBlock;
+
+typedef struct _CacheChunk
+{
+    CacheBlock *block;       // NULL if chunk data is in the file only
+    gint64      file_offset; // NO_FILE_SLOT if chunk was never written to the file
+    gboolean    dirty;       // memory copy differs from the file
+    gboolean    slot_mapped; // file slot was mapped since it was written
+    guint       read_end;    // end of data handed out to readers
+} CacheChunk;
+
 struct _Cache
 {
     char*   filename;
-    int     readHandle;
-    int     writeHandle;
+    int     handle;
+    GMutex  lock;
+
+    GArray* chunks;
+    guint   memory_chunks;      // chunks with allocated blocks
+    guint   max_memory_chunks;
+    guint   mapped_chunks;      // chunks with mapped blocks
+    gint64  file_end;           // end of used file slots
 
     gint64  read_position;
     gint64  write_position;
+    gint64  size;               // end of written data
+    gint64  hot_position;       // last position requested by readers
 };
 
+/***********************************************************************************
+ * Blocks
+ ***********************************************************************************/
+static CacheBlock* cache_block_new(void)
+{
+    CacheBlock *block = g_try_new(CacheBlock, 1);
+    if (block)
+    {
+        block->data = (guint8*)g_try_malloc0(CHUNK_SIZE);
+        if (block->data == NULL)
+        {
+            g_free(block);
+            return NULL;
+        }
+        block->refcount = 1;
+        block->mapped = FALSE;
+    }
+    return block;
+}
+
+static CacheBlock* cache_block_map(int handle, gint64 offset)
+{
+    void *data = mmap(NULL, CHUNK_SIZE, PROT_READ, MAP_SHARED, handle, (off_t)offset);
+    if (data == MAP_FAILED)
+        return NULL;
+
+    CacheBlock *block = g_try_new(CacheBlock, 1);
+    if (block == NULL)
+    {
+        munmap(data, CHUNK_SIZE);
+        return NULL;
+    }
+    block->data = (guint8*)data;
+    block->refcount = 1;
+    block->mapped = TRUE;
+    return block;
+}
+
+// May be called from any thread when downstream releases a buffer.
+static void cache_block_unref(gpointer data)
+{
+    CacheBlock *block = (CacheBlock*)data;
+    if (g_atomic_int_dec_and_test(&block->refcount))
+    {
+        if (block->mapped)
+            munmap(block->data, CHUNK_SIZE);
+        else
+            g_free(block->data);
+        g_free(block);
+    }
+}
+
+static gboolean cache_write_chunk(int handle, const guint8 *data, gint64 offset)
+{
+    gsize done = 0;
+    while (done < CHUNK_SIZE)
+    {
+        ssize_t written = pwrite(handle, data + done, CHUNK_SIZE - done, (off_t)(offset + done));
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return FALSE;
+        done += written;
+    }
+    return TRUE;
+}
+
+static gboolean cache_read_chunk(int handle, guint8 *data, gint64 offset)
+{
+    gsize done = 0;
+    while (done < CHUNK_SIZE)
+    {
+        ssize_t read_bytes = pread(handle, data + done, CHUNK_SIZE - done, (off_t)(offset + done));
+        if (read_bytes < 0 && errno == EINTR)
+            continue;
+        if (read_bytes <= 0)
+            return FALSE;
+        done += read_bytes;
+    }
+    return TRUE;
+}
+
+/***********************************************************************************
+ * Chunks. Must be called with cache lock held.
+ ***********************************************************************************/
+static CacheChunk* cache_get_chunk(Cache *cache, guint index)
+{
+    if (index >= cache->chunks->len)
+    {
+        guint i = cache->chunks->len;
+        g_array_set_size(cache->chunks, index + 1);
+        for (; i <= index; i++)
+            g_array_index(cache->chunks, CacheChunk, i).file_offset = NO_FILE_SLOT;
+    }
+    return &g_array_index(cache->chunks, CacheChunk, index);
+}
+
+static void cache_release_block(Cache *cache, CacheChunk *chunk)
+{
+    if (chunk->block->mapped)
+        cache->mapped_chunks--;
+    else
+        cache->memory_chunks--;
+
+    cache_block_unref(chunk->block);
+    chunk->block = NULL;
+}
+
+// Moves chunk data to the file and releases its memory.
+static gboolean cache_spill_chunk(Cache *cache, CacheChunk *chunk)
+{
+    if (chunk->dirty || chunk->file_offset == NO_FILE_SLOT)
+    {
+        gint64 offset = chunk->file_offset;
+
+        // Never overwrite file data which readers may still have mapped.
+        if (offset == NO_FILE_SLOT || chunk->slot_mapped)
+            offset = cache->file_end;
+
+        if (!cache_write_chunk(cache->handle, chunk->block->data, offset))
+            return FALSE;
+
+        if (offset == cache->file_end)
+            cache->file_end += CHUNK_SIZE;
+        chunk->file_offset = offset;
+        chunk->dirty = FALSE;
+        chunk->slot_mapped = FALSE;
+    }
+
+    cache_release_block(cache, chunk);
+    return TRUE;
+}
+
+// Data behind the readers is less likely to be needed than data ahead of them.
+static guint cache_chunk_distance(Cache *cache, guint index)
+{
+    guint hot_index = (guint)(cache->hot_position >> CHUNK_SHIFT);
+    return index < hot_index ? 2 * (hot_index - index) : index - hot_index;
+}
+
+// Spills and unmaps chunks farthest from the readers until the cache is within
+// its limits. The keep chunk is about to be used by the caller.
+static void cache_trim(Cache *cache, guint keep)
+{
+    guint write_index = (guint)(cache->write_position >> CHUNK_SHIFT);
+
+    while (cache->memory_chunks > cache->max_memory_chunks || cache->mapped_chunks > MAX_MAPPED_CHUNKS)
+    {
+        gboolean    trim_memory = cache->memory_chunks > cache->max_memory_chunks;
+        CacheChunk *victim = NULL;
+        guint       victim_distance = 0;
+        guint       i;
+
+        for (i = 0; i < cache->chunks->len; i++)
+        {
+            CacheChunk *chunk = &g_array_index(cache->chunks, CacheChunk, i);
+            if (chunk->block == NULL || i == keep)
+                continue;
+
+            if (trim_memory ? (chunk->block->mapped || i == write_index) : !chunk->block->mapped)
+                continue;
+
+            guint distance = cache_chunk_distance(cache, i);
+            if (victim == NULL || distance > victim_distance)
+            {
+                victim = chunk;
+                victim_distance = distance;
+            }
+        }
+
+        if (victim == NULL)
+            break;
+
+        if (!trim_memory)
+            cache_release_block(cache, victim);
+        else if (!cache_spill_chunk(cache, victim))
+            break; // File is not writable, keep data in memory.
+    }
+}
+
+static CacheChunk* cache_get_writable_chunk(Cache *cache, guint index, guint offset)
+{
+    CacheChunk *chunk = cache_get_chunk(cache, index);
+    CacheBlock *block = chunk->block;
+
+    if (block != NULL &&
+        (block->mapped || (offset < chunk->read_end && g_atomic_int_get(&block->refcount) > 1)))
+    {
+        // Readers may still hold buffers wrapping this data, write into a copy.
+        CacheBlock *copy = cache_block_new();
+        if (copy == NULL)
+            return NULL;
+
+        memcpy(copy->data, block->data, CHUNK_SIZE);
+        cache_release_block(cache, chunk);
+        chunk->block = copy;
+        chunk->read_end = 0;
+        cache->memory_chunks++;
+    }
+    else if (block == NULL)
+    {
+        block = cache_block_new();
+        if (block == NULL)
+            return NULL;
+
+        if (chunk->file_offset != NO_FILE_SLOT && !cache_read_chunk(cache->handle, block->data, chunk->file_offset))
+        {
+            cache_block_unref(block);
+            return NULL;
+        }
+
+        chunk->block = block;
+        chunk->read_end = 0;
+        cache->memory_chunks++;
+    }
+
+    chunk->dirty = TRUE;
+    cache_trim(cache, index);
+    return chunk;
+}
+
+static CacheChunk* cache_get_readable_chunk(Cache *cache, guint index)
+{
+    CacheChunk *chunk = cache_get_chunk(cache, index);
+
+    if (chunk->block == NULL)
+    {
+        // Gap left by write position set beyond written data reads as zeros.
+        if (chunk->file_offset == NO_FILE_SLOT)
+            return cache_get_writable_chunk(cache, index, 0);
+
+        chunk->block = cache_block_map(cache->handle, chunk->file_offset);
+        if (chunk->block == NULL)
+            return NULL;
+
+        chunk->slot_mapped = TRUE;
+        cache->mapped_chunks++;
+        cache_trim(cache, index);
+    }
+
+    return chunk;
+}
+
+// Wraps [position, position + size) into a buffer. Range must be written already.
+static GstBuffer* cache_wrap_range(Cache *cache, gint64 position, guint size)
+{
+    GstBuffer *buffer = gst_buffer_new();
+    gint64     end = position + size;
+
+    cache->hot_position = position;
+
+    while (position < end)
+    {
+        guint       index = (guint)(position >> CHUNK_SHIFT);
+        guint       offset = (guint)(position & CHUNK_MASK);
+        guint       count = (guint)MIN(end - position, (gint64)(CHUNK_SIZE - offset));
+        CacheChunk *chunk = cache_get_readable_chunk(cache, index);
+
+        if (chunk == NULL)
+        {
+            // INLINE - gst_buffer_unref()
+            gst_buffer_unref(buffer);
+            return NULL;
+        }
+
+        g_atomic_int_inc(&chunk->block->refcount);
+        gst_buffer_append_memory(buffer, gst_memory_new_wrapped(GST_MEMORY_FLAG_READONLY, chunk->block->data,
+                                                                CHUNK_SIZE, offset, count,
+                                                                chunk->block, cache_block_unref));
+        chunk->read_end = MAX(chunk->read_end, offset + count);
+        position += count;
+    }
+
+    return buffer;
+}
+
+/***********************************************************************************
+ * Cache
+ ***********************************************************************************/
 void cache_static_init(void)
 {
     tempDir = g_get_tmp_dir();
@@ -49,148 +366,177 @@ void cache_static_init(void)
 
 Cache* create_cache()
 {
-    Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
+    Cache* result = g_try_new0(Cache, 1);
     if (result)
     {
         result->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
         if (result->filename == NULL)
             goto _error_exit;
-        else
-        {
-        result->writeHandle = g_mkstemp_full(result->filename, O_RDWR, S_IRUSR|S_IWUSR);
-            result->readHandle = open(result->filename, O_RDONLY, 0);
 
-            if(result->writeHandle < 0 || result->readHandle < 0)
-                goto _error_exit;
+        result->handle = g_mkstemp_full(result->filename, O_RDWR, S_IRUSR|S_IWUSR);
+        if (result->handle < 0)
+            goto _error_exit;
 
         if (unlink(result->filename) < 0)
         {
-            close (result->writeHandle);
-            close (result->readHandle);
-        goto _error_exit;
+            close(result->handle);
+            goto _error_exit;
         }
 
-            result->read_position = result->write_position = 0;
-        }
+        g_mutex_init(&result->lock);
+        result->chunks = g_array_new(FALSE, TRUE, sizeof(CacheChunk));
+        result->max_memory_chunks = CACHE_DEFAULT_MEMORY_SIZE >> CHUNK_SHIFT;
     }
     return result;
 
 _error_exit:
+    g_free(result->filename);
     g_free(result);
     return NULL;
 }
 
 void destroy_cache(Cache* instance)
 {
-    close(instance->writeHandle);
-    close(instance->readHandle);
+    guint i;
+
+    // Blocks still wrapped by buffers are freed when the buffers are released.
+    for (i = 0; i < instance->chunks->len; i++)
+    {
+        CacheChunk *chunk = &g_array_index(instance->chunks, CacheChunk, i);
+        if (chunk->block)
+            cache_block_unref(chunk->block);
+    }
+    g_array_free(instance->chunks, TRUE);
+
+    close(instance->handle);
+    g_mutex_clear(&instance->lock);
     g_free(instance->filename);
 
     g_free(instance);
 }
 
+void cache_set_memory_limit(Cache* cache, guint64 size)
+{
+    g_mutex_lock(&cache->lock);
+    cache->max_memory_chunks = (guint)MAX(size >> CHUNK_SHIFT, 1);
+    cache_trim(cache, G_MAXUINT);
+    g_mutex_unlock(&cache->lock);
+}
+
 void cache_write_buffer(Cache* cache, GstBuffer* buffer)
 {
     GstMapInfo info;
     if (gst_buffer_map(buffer, &info, GST_MAP_READ))
     {
-        ssize_t written = write(cache->writeHandle, info.data, info.size);
-        if (written > 0)
-            cache->write_position += written;
+        const guint8 *data = info.data;
+        gsize         left = info.size;
+
+        g_mutex_lock(&cache->lock);
+        while (left > 0)
+        {
+            guint       index = (guint)(cache->write_position >> CHUNK_SHIFT);
+            guint       offset = (guint)(cache->write_position & CHUNK_MASK);
+            gsize       count = MIN(left, (gsize)(CHUNK_SIZE - offset));
+            CacheChunk *chunk = cache_get_writable_chunk(cache, index, offset);
+
+            if (chunk == NULL)
+                break;
+
+            memcpy(chunk->block->data + offset, data, count);
+            data += count;
+            left -= count;
+            cache->write_position += count;
+            if (cache->size < cache->write_position)
+                cache->size = cache->write_position;
+        }
+        g_mutex_unlock(&cache->lock);
+
         gst_buffer_unmap(buffer, &info);
     }
 }
 
 gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
 {
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    gint64 result = 0;
     *buffer = NULL;
 
-    if (data)
-    {
-        ssize_t size = 0;
-        if ((cache->write_position - cache->read_position) > 0 &&
-            (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-            size = cache->write_position - cache->read_position;
-        else
-            size = DEFAULT_BUFFER_SIZE;
+    g_mutex_lock(&cache->lock);
 
-        ssize_t read_bytes = read(cache->readHandle, data, size);
-        if (read_bytes > 0)
-        {
-            *buffer = gst_buffer_new_wrapped_full(0, data, DEFAULT_BUFFER_SIZE, 0, read_bytes, data, g_free);
-            if (*buffer != NULL)
-                GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+    gint64 limit = cache->write_position > cache->read_position ? cache->write_position : cache->size;
+    gint64 size = MIN(limit - cache->read_position, DEFAULT_BUFFER_SIZE);
 
-            cache->read_position += read_bytes;
-            return cache->read_position;
+    // Do not cross chunk boundary, so buffer wraps single memory block.
+    size = MIN(size, CHUNK_SIZE - (cache->read_position & CHUNK_MASK));
+    if (size > 0)
+    {
+        *buffer = cache_wrap_range(cache, cache->read_position, (guint)size);
+        if (*buffer != NULL)
+        {
+            GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+            cache->read_position += size;
+            result = cache->read_position;
         }
-        else // read error, deleting buffer to avoid leaking.
-            g_free(data);
     }
 
-    return 0;
+    g_mutex_unlock(&cache->lock);
+    return result;
 }
 
-GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+GstFlowReturn cache_read_buffer_at(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
     *buffer = NULL;
 
-    if (cache_set_read_position(cache, start_position))
-    {
-        guint8 *data = (guint8*)g_try_malloc(size);
-        if (data)
+    g_mutex_lock(&cache->lock);
+    if (start_position >= 0 && start_position + size <= cache->size)
     {
-        ssize_t read_bytes = read(cache->readHandle, data, size);
-            if (read_bytes == size)
-            {
-                *buffer = gst_buffer_new_wrapped_full(0, data, size, 0, read_bytes, data, g_free);
-                if (*buffer != NULL)
-                {
-                    GST_BUFFER_OFFSET(*buffer) = cache->read_position;
-                    result = GST_FLOW_OK;
-                }
-            }
-            else
-            g_free(data); // Wrong size, deleting buffer to avoid leaking.
-
-            cache->read_position += read_bytes;
-    }
+        *buffer = cache_wrap_range(cache, start_position, size);
+        if (*buffer != NULL)
+        {
+            GST_BUFFER_OFFSET(*buffer) = start_position;
+            result = GST_FLOW_OK;
+        }
     }
+    g_mutex_unlock(&cache->lock);
+
     return result;
 }
 
-static inline gboolean cache_set_handler_position(int handle, guint64 position)
+GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
-    return lseek(handle, position, SEEK_SET) >= 0;
+    GstFlowReturn result = cache_read_buffer_at(cache, start_position, size, buffer);
+    if (result == GST_FLOW_OK)
+        cache_set_read_position(cache, start_position + size);
+    return result;
 }
 
 gboolean cache_set_write_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->write_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->writeHandle, position);
-        if (result)
-            cache->write_position = position;
-    }
-    return result;
+    if (position < 0)
+        return FALSE;
+
+    g_mutex_lock(&cache->lock);
+    cache->write_position = position;
+    g_mutex_unlock(&cache->lock);
+    return TRUE;
 }
 
 gboolean cache_set_read_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->read_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->readHandle, position);
-        if (result)
-            cache->read_position = position;
-    }
-    return result;
+    if (position < 0)
+        return FALSE;
+
+    g_mutex_lock(&cache->lock);
+    cache->read_position = position;
+    cache->hot_position = position;
+    g_mutex_unlock(&cache->lock);
+    return TRUE;
 }
 
 gboolean cache_has_enough_data(Cache* cache)
 {
-    return cache->read_position < cache->write_position;
+    g_mutex_lock(&cache->lock);
+    gboolean result = cache->read_position < cache->write_position;
+    g_mutex_unlock(&cache->lock);
+    return result;
 }
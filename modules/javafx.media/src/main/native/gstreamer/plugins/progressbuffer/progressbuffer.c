@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,7 +48,8 @@ enum
     PROP_THRESHOLD,
     PROP_BANDWIDTH,
     PROP_PREBUFFER_TIME,
-    PROP_WAIT_TOLERANCE
+    PROP_WAIT_TOLERANCE,
+    PROP_MEMORY_CACHE_SIZE
 };
 
 /***********************************************************************************
@@ -85,6 +86,7 @@ struct _ProgressBuffer
     gdouble       bandwidth; // property accessible.
     gdouble       prebuffer_time; // property controlled.
     gdouble       wait_tolerance; // property controlled.
+    guint64       memory_cache_size; // property controlled.
     GTimer        *bandwidth_timer;
 
     gboolean      unexpected;
@@ -238,6 +240,15 @@ static void progress_buffer_class_init (ProgressBufferClass *klass)
                                                           2.0  /* default value */,
                                                           G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
 
+    g_object_class_install_property (gobject_class, PROP_MEMORY_CACHE_SIZE,
+                                     g_param_spec_uint64 ("memory-cache-size",
+                                                          "Memory cache size",
+                                                          "Amount of data in bytes kept in memory around the read position, the rest is kept in the file.",
+                                                          0  /* minimum value */,
+                                                          G_MAXUINT64 /* maximum value */,
+                                                          CACHE_DEFAULT_MEMORY_SIZE  /* default value */,
+                                                          G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
     cache_static_init();
 }
 
@@ -289,6 +300,13 @@ static void progress_buffer_set_property (GObject *object, guint property_id,
         case PROP_WAIT_TOLERANCE:
             element->wait_tolerance = g_value_get_double(value);
             break;
+        case PROP_MEMORY_CACHE_SIZE:
+            g_mutex_lock(&element->lock);
+            element->memory_cache_size = g_value_get_uint64(value);
+            if (element->cache)
+                cache_set_memory_limit(element->cache, element->memory_cache_size);
+            g_mutex_unlock(&element->lock);
+            break;
 
         default:
             break;
@@ -322,6 +340,10 @@ static void progress_buffer_get_property (GObject *object, guint property_id,
             g_value_set_double(value, element->wait_tolerance);
             break;
 
+        case PROP_MEMORY_CACHE_SIZE:
+            g_value_set_uint64(value, element->memory_cache_size);
+            break;
+
         default:
             break;
     }
@@ -649,6 +671,7 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
                         gst_event_unref(event); // INLINE - gst_event_unref()
                         return GST_FLOW_ERROR;
                     }
+                    cache_set_memory_limit(element->cache, element->memory_cache_size);
                 }
                 else
                 {
@@ -1065,7 +1088,7 @@ static GstFlowReturn progress_buffer_getrange(GstPad *pad, GstObject *parent, gu
         result = GST_FLOW_EOS;
     else if (element->sink_segment.start <= (gint64)start_position &&
              element->sink_segment.position >= (gint64)end_position)
-        result = cache_read_buffer_from_position(element->cache, start_position, size, buffer);
+        result = cache_read_buffer_at(element->cache, start_position, size, buffer);
     else
     {
 #if ENABLE_SOURCE_SEEKING
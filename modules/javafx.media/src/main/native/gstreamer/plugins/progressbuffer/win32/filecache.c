@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -163,6 +163,23 @@ static gboolean cache_set_handler_position(HANDLE handle, guint64 position)
     return (li.LowPart != INVALID_SET_FILE_POINTER || GetLastError() == NO_ERROR);
 }
 
+GstFlowReturn cache_read_buffer_at(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+{
+    gint64        read_position = cache->read_position;
+    GstFlowReturn result = cache_read_buffer_from_position(cache, start_position, size, buffer);
+
+    // Restore position for the other readers.
+    if (cache_set_handler_position(cache->readHandle, read_position))
+        cache->read_position = read_position;
+
+    return result;
+}
+
+void cache_set_memory_limit(Cache* cache, guint64 size)
+{
+    // All data goes to the temporary file, which is cached by the system.
+}
+
 gboolean cache_set_write_position(Cache* cache, gint64 position)
 {
     gboolean result = (position == cache->write_position);
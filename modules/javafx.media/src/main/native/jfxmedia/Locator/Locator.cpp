@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@ CLocator::CLocator(LocatorType type, const char* contentType, const char* locati
     m_contentType = contentType;
     m_location = string(location);
     m_llSizeHint = -1;
+    m_iDecoderThreadCount = 0;
 }
 
 CLocator::CLocator(LocatorType type, const char* contentType, const char* location, int64_t llSizeHint)
@@ -44,6 +45,7 @@ CLocator::CLocator(LocatorType type, const char* contentType, const char* locati
     m_contentType = contentType;
     m_location = string(location);
     m_llSizeHint = llSizeHint;
+    m_iDecoderThreadCount = 0;
 }
 
 CLocator::LocatorType CLocator::GetType()
@@ -80,6 +82,35 @@ jstring CLocator::LocatorGetStringLocation(JNIEnv *env, jobject locator)
     return result;
 }
 
+int CLocator::LocatorGetDecoderThreadCount(JNIEnv *env, jobject locator)
+{
+    if (env == NULL || locator == NULL)
+        return 0;
+
+    CJavaEnvironment javaEnv(env);
+
+    static jmethodID mid_GetDecoderThreadCount = NULL;
+    if (mid_GetDecoderThreadCount == NULL)
+    {
+        jclass klass = env->GetObjectClass(locator);
+
+        mid_GetDecoderThreadCount = env->GetMethodID(klass, "getDecoderThreadCount", "()I");
+        env->DeleteLocalRef(klass);
+        if (javaEnv.clearException() || mid_GetDecoderThreadCount == NULL)
+        {
+            return 0;
+        }
+    }
+
+    jint result = env->CallIntMethod(locator, mid_GetDecoderThreadCount);
+    if (javaEnv.clearException())
+    {
+        return 0;
+    }
+
+    return (int)result;
+}
+
 jobject CLocator::CreateConnectionHolder(JNIEnv *env, jobject locator)
 {
     if (env == NULL || locator == NULL)
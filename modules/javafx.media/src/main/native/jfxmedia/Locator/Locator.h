@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,6 +49,7 @@ public:
     LocatorType GetType();
 
     static jstring LocatorGetStringLocation(JNIEnv *env, jobject locator);
+    static int     LocatorGetDecoderThreadCount(JNIEnv *env, jobject locator);
 
     static jobject CreateConnectionHolder(JNIEnv *env, jobject locator);
     static jobject GetAudioStreamConnectionHolder(JNIEnv *env, jobject locator, jobject connectionHolder);
@@ -59,11 +60,15 @@ public:
 
     int64_t    GetSizeHint();
 
+    inline void SetDecoderThreadCount(int count) { m_iDecoderThreadCount = count; }
+    inline int  GetDecoderThreadCount() { return m_iDecoderThreadCount; }
+
 protected:
     LocatorType m_type;
     string      m_contentType;
     string      m_location;
     int64_t     m_llSizeHint;
+    int         m_iDecoderThreadCount; // 0 - one thread per CPU core
 };
 
 #endif  //_LOCATOR_H_
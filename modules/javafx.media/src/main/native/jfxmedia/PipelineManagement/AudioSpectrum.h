@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,10 @@ public:
     static CBandsHolder* AddRef(CBandsHolder* holder);
     static void          ReleaseRef(CBandsHolder* holder);
 
+    // Called after UpdateBands(), returns true if a spectrum event should be
+    // sent. Holders may return false while a previous event is unconsumed.
+    virtual bool         RequestNotification() { return true; }
+
 protected:
     static void          InitRef(CBandsHolder* holder);
 
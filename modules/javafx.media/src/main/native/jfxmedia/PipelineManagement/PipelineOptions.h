@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,7 +47,8 @@ public:
         m_StreamMimeType(-1),
         m_AudioStreamMimeType(-1),
         m_bHLSModeEnabled(false),
-        m_audioFlags(0)
+        m_audioFlags(0),
+        m_VideoDecoderThreadCount(0)
     {}
 
     virtual ~CPipelineOptions() {}
@@ -73,6 +74,10 @@ public:
     inline void  SetAudioFlags(int audioFlags) { m_audioFlags = audioFlags; }
     inline int  GetAudioFlags() { return m_audioFlags; }
 
+    // Number of video decoder threads, 0 - one thread per CPU core.
+    inline void SetVideoDecoderThreadCount(int count) { m_VideoDecoderThreadCount = count; }
+    inline int  GetVideoDecoderThreadCount() { return m_VideoDecoderThreadCount; }
+
     // Returns true if we need to force default track ID. For multi source streams
     // two demuxers (qtdemux in case of fMP4 HLS with EXT-X-MEDIA) will report same
     // ID, since two demuxers are not aware of each other and that we actually
@@ -109,6 +114,7 @@ private:
     int         m_AudioStreamMimeType;
     bool        m_bHLSModeEnabled;
     int         m_audioFlags;
+    int         m_VideoDecoderThreadCount;
 
     // Audio parser or demultiplexer for main stream
     string      m_StreamParser;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -425,6 +425,158 @@ __m128i inline_loadu_si128(const __m128i *p)
     pd += 16;                   \
 }
 
+// --- Begin AVX2 YCbCr420p conversion functions
+// AVX2 is not part of the build baseline, so AVX2 code is compiled for that
+// target only and selected at runtime.
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#define ENABLE_SIMD_AVX2 1
+#define TARGET_AVX2
+#elif defined(__GNUC__)
+#include <immintrin.h>
+#define ENABLE_SIMD_AVX2 1
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ENABLE_SIMD_AVX2 0
+#endif
+
+#if ENABLE_SIMD_AVX2
+static int colorconvert_has_avx2(void)
+{
+    static int hasAVX2 = -1;
+
+    if (hasAVX2 < 0) {
+#if defined(_MSC_VER)
+        int info[4];
+        int maxLeaf, osxsave, avx;
+
+        __cpuid(info, 0);
+        maxLeaf = info[0];
+        __cpuid(info, 1);
+        osxsave = (info[2] >> 27) & 1;
+        avx = (info[2] >> 28) & 1;
+        // OS must save YMM registers too
+        if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            hasAVX2 = (info[1] >> 5) & 1;
+        } else {
+            hasAVX2 = 0;
+        }
+#else
+        hasAVX2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+#endif
+    }
+
+    return hasAVX2;
+}
+
+/*
+ * Converts 32 pixel wide blocks of two rows at a time with same arithmetic as
+ * SSE2 functions below, so results are identical. Returns number of converted
+ * columns, remaining columns should be converted by caller.
+ * bgra - 1 for BGRA32 byte order, 0 for ARGB32 byte order.
+ */
+TARGET_AVX2
+static int32_t ColorConvert_YCbCr420p_to_RGB32_no_alpha_avx2(
+                                                  uint8_t *dst,
+                                                  int32_t dst_stride,
+                                                  int32_t width,
+                                                  int32_t height,
+                                                  const uint8_t *y,
+                                                  const uint8_t *v,
+                                                  const uint8_t *u,
+                                                  int32_t y_stride,
+                                                  int32_t v_stride,
+                                                  int32_t u_stride,
+                                                  int bgra)
+{
+    const __m256i x_c0 = _mm256_set1_epi16(0x2543);
+    const __m256i x_c1 = _mm256_set1_epi16(0x4097);
+    const __m256i x_c4 = _mm256_set1_epi16(0xc8b);
+    const __m256i x_c5 = _mm256_set1_epi16(0x1a06);
+    const __m256i x_c8 = _mm256_set1_epi16(0x3317);
+    const __m256i x_coff0 = _mm256_set1_epi16((short)0xdd60);
+    const __m256i x_coff1 = _mm256_set1_epi16(0x10f4);
+    const __m256i x_coff2 = _mm256_set1_epi16((short)0xe420);
+    const __m256i x_zero = _mm256_setzero_si256();
+    const __m256i x_aa = _mm256_set1_epi8((char)0xff);
+
+    int32_t blocks = width & ~31;
+    int32_t jH, iW, row;
+    __m256i x_u, x_v, x_b, x_g, x_r, x_y, x_ylo, x_yhi;
+    __m256i x_blo, x_bhi, x_glo, x_ghi, x_rlo, x_rhi;
+    __m256i x_c[4], x_01l, x_01h, x_23l, x_23h, x_p0, x_p1, x_p2, x_p3;
+    const uint8_t *pU, *pV, *pY;
+    uint8_t *pD;
+
+    for (jH = 0; jH < (height >> 1); jH++) {
+        pU = u + jH * u_stride;
+        pV = v + jH * v_stride;
+
+        for (iW = 0; iW < blocks; iW += 32) {
+            /* 16 chroma samples for 32 pixels, lanes hold samples 0-7 and 8-15 */
+            x_u = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pU + (iW >> 1)))), 8);
+            x_v = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pV + (iW >> 1)))), 8);
+
+            x_b = _mm256_add_epi16(_mm256_mulhi_epu16(x_u, x_c1), x_coff0);
+            x_g = _mm256_sub_epi16(x_coff1, _mm256_add_epi16(_mm256_mulhi_epu16(x_u, x_c4),
+                                                             _mm256_mulhi_epu16(x_v, x_c5)));
+            x_r = _mm256_add_epi16(_mm256_mulhi_epu16(x_v, x_c8), x_coff2);
+
+            /* duplicate for pixel pairs: lo - pixels 0-7 and 16-23, hi - pixels 8-15 and 24-31 */
+            x_blo = _mm256_unpacklo_epi16(x_b, x_b);
+            x_bhi = _mm256_unpackhi_epi16(x_b, x_b);
+            x_glo = _mm256_unpacklo_epi16(x_g, x_g);
+            x_ghi = _mm256_unpackhi_epi16(x_g, x_g);
+            x_rlo = _mm256_unpacklo_epi16(x_r, x_r);
+            x_rhi = _mm256_unpackhi_epi16(x_r, x_r);
+
+            for (row = 0; row < 2; row++) {
+                pY = y + (2 * jH + row) * y_stride + iW;
+                pD = dst + (2 * jH + row) * dst_stride + iW * 4;
+
+                x_y = _mm256_loadu_si256((const __m256i*)pY);
+                x_ylo = _mm256_mulhi_epu16(_mm256_unpacklo_epi8(x_zero, x_y), x_c0);
+                x_yhi = _mm256_mulhi_epu16(_mm256_unpackhi_epi8(x_zero, x_y), x_c0);
+
+                /* pack: 16=>8, pixels are back in order */
+                x_b = _mm256_packus_epi16(_mm256_srai_epi16(_mm256_add_epi16(x_ylo, x_blo), 5),
+                                          _mm256_srai_epi16(_mm256_add_epi16(x_yhi, x_bhi), 5));
+                x_g = _mm256_packus_epi16(_mm256_srai_epi16(_mm256_add_epi16(x_ylo, x_glo), 5),
+                                          _mm256_srai_epi16(_mm256_add_epi16(x_yhi, x_ghi), 5));
+                x_r = _mm256_packus_epi16(_mm256_srai_epi16(_mm256_add_epi16(x_ylo, x_rlo), 5),
+                                          _mm256_srai_epi16(_mm256_add_epi16(x_yhi, x_rhi), 5));
+
+                if (bgra) {
+                    x_c[0] = x_b; x_c[1] = x_g; x_c[2] = x_r; x_c[3] = x_aa;
+                } else {
+                    x_c[0] = x_aa; x_c[1] = x_r; x_c[2] = x_g; x_c[3] = x_b;
+                }
+
+                x_01l = _mm256_unpacklo_epi8(x_c[0], x_c[1]);
+                x_01h = _mm256_unpackhi_epi8(x_c[0], x_c[1]);
+                x_23l = _mm256_unpacklo_epi8(x_c[2], x_c[3]);
+                x_23h = _mm256_unpackhi_epi8(x_c[2], x_c[3]);
+
+                x_p0 = _mm256_unpacklo_epi16(x_01l, x_23l); /* pixels 0-3, 16-19 */
+                x_p1 = _mm256_unpackhi_epi16(x_01l, x_23l); /* pixels 4-7, 20-23 */
+                x_p2 = _mm256_unpacklo_epi16(x_01h, x_23h); /* pixels 8-11, 24-27 */
+                x_p3 = _mm256_unpackhi_epi16(x_01h, x_23h); /* pixels 12-15, 28-31 */
+
+                _mm256_storeu_si256((__m256i*)pD, _mm256_permute2x128_si256(x_p0, x_p1, 0x20));
+                _mm256_storeu_si256((__m256i*)(pD + 32), _mm256_permute2x128_si256(x_p2, x_p3, 0x20));
+                _mm256_storeu_si256((__m256i*)(pD + 64), _mm256_permute2x128_si256(x_p0, x_p1, 0x31));
+                _mm256_storeu_si256((__m256i*)(pD + 96), _mm256_permute2x128_si256(x_p2, x_p3, 0x31));
+            }
+        }
+    }
+
+    return blocks;
+}
+#endif // ENABLE_SIMD_AVX2
+// --- End AVX2 YCbCr420p conversion functions
+
 /*
  * cc = 16 color values
  * aa = 16 corresponding alpha values to premultiply with
@@ -995,6 +1147,22 @@ int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
     else
         load_si128 = &inline_load_si128;
 
+#if ENABLE_SIMD_AVX2
+    if (colorconvert_has_avx2()) {
+        iW = ColorConvert_YCbCr420p_to_RGB32_no_alpha_avx2(argb, argb_stride, width, height,
+                                                          y, v, u, y_stride, v_stride, u_stride, 0);
+        if (iW == width)
+            return 0;
+
+        // Convert remaining columns below
+        argb += iW * 4;
+        y += iW;
+        v += iW >> 1;
+        u += iW >> 1;
+        width -= iW;
+    }
+#endif // ENABLE_SIMD_AVX2
+
     pY1 = (uint8_t*)y;
     pY2 = (uint8_t*)y + y_stride;
     pU = (uint8_t*)u;
@@ -1962,6 +2130,22 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
     else
         load_si128 = &inline_load_si128;
 
+#if ENABLE_SIMD_AVX2
+    if (colorconvert_has_avx2()) {
+        iW = ColorConvert_YCbCr420p_to_RGB32_no_alpha_avx2(bgra, bgra_stride, width, height,
+                                                          y, v, u, y_stride, v_stride, u_stride, 1);
+        if (iW == width)
+            return 0;
+
+        // Convert remaining columns below
+        bgra += iW * 4;
+        y += iW;
+        v += iW >> 1;
+        u += iW >> 1;
+        width -= iW;
+    }
+#endif // ENABLE_SIMD_AVX2
+
     pY1 = (uint8_t*)y;
     pY2 = (uint8_t*)y + y_stride;
     pU = (uint8_t*)u;
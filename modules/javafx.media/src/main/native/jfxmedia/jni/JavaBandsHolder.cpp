@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,60 @@
 
 #include "JavaBandsHolder.h"
 #include "JniUtils.h"
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Ring header and frame stamps are shared with the Java consumer.
+#if defined(_MSC_VER)
+static inline int64_t BandsLoad(uint8_t *base, size_t offset)
+{
+    return _InterlockedCompareExchange64((volatile __int64*)(base + offset), 0, 0);
+}
+
+static inline void BandsStore(uint8_t *base, size_t offset, int64_t value)
+{
+    _InterlockedExchange64((volatile __int64*)(base + offset), value);
+}
+
+static inline int64_t BandsExchange(uint8_t *base, size_t offset, int64_t value)
+{
+    return _InterlockedExchange64((volatile __int64*)(base + offset), value);
+}
+
+// Interlocked operations are already full barriers
+static inline void BandsFence()
+{
+}
+#else
+static inline int64_t BandsLoad(uint8_t *base, size_t offset)
+{
+    return __atomic_load_n((int64_t*)(base + offset), __ATOMIC_SEQ_CST);
+}
+
+static inline void BandsStore(uint8_t *base, size_t offset, int64_t value)
+{
+    __atomic_store_n((int64_t*)(base + offset), value, __ATOMIC_SEQ_CST);
+}
+
+static inline int64_t BandsExchange(uint8_t *base, size_t offset, int64_t value)
+{
+    return __atomic_exchange_n((int64_t*)(base + offset), value, __ATOMIC_SEQ_CST);
+}
+
+static inline void BandsFence()
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+#endif
 
 CJavaBandsHolder::CJavaBandsHolder()
+    : m_jvm(NULL),
+      m_Bands(0),
+      m_Buffer(NULL),
+      m_pRing(NULL),
+      m_FrameSize(0)
 {
 }
 
@@ -36,21 +88,14 @@ CJavaBandsHolder::~CJavaBandsHolder()
         CJavaEnvironment jenv(m_jvm);
         JNIEnv *pEnv = jenv.getEnvironment();
 
-        if (pEnv) {
-            if (m_Magnitudes) {
-                pEnv->DeleteGlobalRef(m_Magnitudes);
-                m_Magnitudes = NULL;
-            }
-
-            if (m_Phases) {
-                pEnv->DeleteGlobalRef(m_Phases);
-                m_Phases = NULL;
-            }
+        if (pEnv && m_Buffer) {
+            pEnv->DeleteGlobalRef(m_Buffer);
+            m_Buffer = NULL;
         }
     }
 }
 
-bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases)
+bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jobject buffer)
 {
     env->GetJavaVM(&m_jvm);
     if (env->ExceptionCheck()) {
@@ -60,8 +105,18 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
     }
 
     m_Bands = bands;
-    m_Magnitudes = (jfloatArray)env->NewGlobalRef(magnitudes);
-    m_Phases = (jfloatArray)env->NewGlobalRef(phases);
+    m_FrameSize = BANDS_FRAME_HEADER_SIZE + 2 * bands * sizeof(float);
+
+    uint8_t *ring = (uint8_t*)env->GetDirectBufferAddress(buffer);
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (ring == NULL || capacity < (jlong)(BANDS_HEADER_SIZE + BANDS_RING_FRAMES * m_FrameSize))
+        return false;
+
+    // Global reference keeps the ring alive while the pipeline may write to it
+    m_Buffer = env->NewGlobalRef(buffer);
+    if (m_Buffer == NULL)
+        return false;
+    m_pRing = ring;
 
     InitRef(this);
 
@@ -70,25 +125,29 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
 
 void CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
-    if (m_Bands != size || m_jvm == NULL)
+    if (m_Bands != size || m_pRing == NULL)
         return;
 
-    CJavaEnvironment jenv(m_jvm);
-    JNIEnv *pEnv = jenv.getEnvironment();
-    if (pEnv) {
-        // use local references due to threading issues
-        jfloatArray localMagnitudes = (jfloatArray)pEnv->NewLocalRef(m_Magnitudes);
-        jfloatArray localPhases = (jfloatArray)pEnv->NewLocalRef(m_Phases);
-
-        if (localMagnitudes && localPhases) {
-            pEnv->SetFloatArrayRegion(localMagnitudes, 0, size, magnitudes);
-            if (!jenv.clearException()) {
-                pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
-                jenv.clearException();
-            }
-        }
+    // Single producer: only the thread delivering bands advances the count.
+    int64_t frame = BandsLoad(m_pRing, BANDS_WRITE_COUNT_OFFSET);
+    uint8_t *slot = m_pRing + BANDS_HEADER_SIZE + (size_t)(frame % BANDS_RING_FRAMES) * m_FrameSize;
+    float *values = (float*)(slot + BANDS_FRAME_HEADER_SIZE);
 
-        pEnv->DeleteLocalRef(localMagnitudes);
-        pEnv->DeleteLocalRef(localPhases);
-    }
+    BandsStore(slot, 0, 2 * frame + 1);
+    BandsFence();
+    memcpy(values, magnitudes, size * sizeof(float));
+    memcpy(values + size, phases, size * sizeof(float));
+    BandsStore(slot, 0, 2 * frame + 2);
+
+    BandsStore(m_pRing, BANDS_WRITE_COUNT_OFFSET, frame + 1);
+}
+
+bool CJavaBandsHolder::RequestNotification()
+{
+    if (m_pRing == NULL)
+        return false;
+
+    // Java clears the flag before it reads the latest frame, so frames
+    // published while an event is outstanding are picked up by that event.
+    return BandsExchange(m_pRing, BANDS_PENDING_OFFSET, 1) == 0;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,8 +27,19 @@
 #define _JAVA_SPECTRUM_UPDATER_H_
 
 #include <jni.h>
+#include <stdint.h>
 #include <PipelineManagement/AudioSpectrum.h>
 
+// Layout of the band ring shared with NativeAudioSpectrum.java. The header
+// holds the number of published frames and the pending event flag, followed
+// by BANDS_RING_FRAMES frames. Each frame is a stamp (2 * frame + 1 while it
+// is written, 2 * frame + 2 once complete) followed by magnitudes and phases.
+#define BANDS_WRITE_COUNT_OFFSET   0
+#define BANDS_PENDING_OFFSET       8
+#define BANDS_HEADER_SIZE          64
+#define BANDS_FRAME_HEADER_SIZE    8
+#define BANDS_RING_FRAMES          4
+
 class CJavaBandsHolder : public CBandsHolder
 {
 public:
@@ -36,14 +47,16 @@ public:
     ~CJavaBandsHolder();
 
 public:
-    bool Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases);
+    bool Init(JNIEnv* env, int bands, jobject buffer);
     void UpdateBands(int size, const float* magnitudes, const float* phases);
+    bool RequestNotification();
 
 private:
     JavaVM      *m_jvm;
     int         m_Bands;
-    jfloatArray m_Magnitudes;
-    jfloatArray m_Phases;
+    jobject     m_Buffer;
+    uint8_t     *m_pRing;
+    size_t      m_FrameSize;
 };
 
 #endif // _JAVA_SPECTRUM_UPDATER_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,32 @@
 #include <stdlib.h>
 #include <string.h>
 #endif // TARGET_OS_LINUX
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Counters in the read-ahead header are shared with the Java producer thread.
+#if defined(_MSC_VER)
+static inline int64_t ReadAheadLoad(uint8_t *header, int offset)
+{
+    return _InterlockedCompareExchange64((volatile __int64*)(header + offset), 0, 0);
+}
+
+static inline void ReadAheadStore(uint8_t *header, int offset, int64_t value)
+{
+    _InterlockedExchange64((volatile __int64*)(header + offset), value);
+}
+#else
+static inline int64_t ReadAheadLoad(uint8_t *header, int offset)
+{
+    return __atomic_load_n((int64_t*)(header + offset), __ATOMIC_SEQ_CST);
+}
+
+static inline void ReadAheadStore(uint8_t *header, int offset, int64_t value)
+{
+    __atomic_store_n((int64_t*)(header + offset), value, __ATOMIC_SEQ_CST);
+}
+#endif
 
 jfieldID  CJavaInputStreamCallbacks::m_BufferFID = 0;
 jmethodID CJavaInputStreamCallbacks::m_NeedBufferMID = 0;
@@ -40,9 +66,15 @@ jmethodID CJavaInputStreamCallbacks::m_IsRandomAccessMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_SeekMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_CloseConnectionMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_PropertyMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_StartReadAheadMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_WaitForReadAheadMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadAheadSpaceAvailableMID = 0;
 
 CJavaInputStreamCallbacks::CJavaInputStreamCallbacks()
-    : m_ConnectionHolder(0)
+    : m_ConnectionHolder(0),
+      m_ReadAheadHeader(NULL),
+      m_ReadAheadData(NULL),
+      m_ReadAheadCapacity(0)
 {}
 
 CJavaInputStreamCallbacks::~CJavaInputStreamCallbacks()
@@ -133,15 +165,62 @@ bool CJavaInputStreamCallbacks::Init(JNIEnv *env, jobject jConnectionHolder)
             hasException = (javaEnv.reportException() || (NULL == m_PropertyMID));
         }
 
+        if (!hasException)
+        {
+            m_StartReadAheadMID = env->GetMethodID(klass, "startReadAhead", "()Ljava/nio/ByteBuffer;");
+            hasException = (javaEnv.reportException() || (NULL == m_StartReadAheadMID));
+        }
+
+        if (!hasException)
+        {
+            m_WaitForReadAheadMID = env->GetMethodID(klass, "waitForReadAhead", "()V");
+            hasException = (javaEnv.reportException() || (NULL == m_WaitForReadAheadMID));
+        }
+
+        if (!hasException)
+        {
+            m_ReadAheadSpaceAvailableMID = env->GetMethodID(klass, "readAheadSpaceAvailable", "()V");
+            hasException = (javaEnv.reportException() || (NULL == m_ReadAheadSpaceAvailableMID));
+        }
+
         if (NULL != klass)
             env->DeleteLocalRef(klass);
 
         methodIDsInitialized = !hasException;
     }
 
+    if (methodIDsInitialized)
+        StartReadAhead(env);
+
     return methodIDsInitialized;
 }
 
+// Sequential sources are read ahead by Java into a ring shared with us,
+// so blocks can be consumed without calling into Java for each of them.
+void CJavaInputStreamCallbacks::StartReadAhead(JNIEnv *env)
+{
+    jobject buffer = env->CallObjectMethod(m_ConnectionHolder, m_StartReadAheadMID);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return;
+    }
+
+    if (NULL == buffer)
+        return;
+
+    uint8_t *header = (uint8_t*)env->GetDirectBufferAddress(buffer);
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (NULL != header && capacity > READ_AHEAD_HEADER_SIZE)
+    {
+        // Buffer is referenced by the connection holder, which we hold.
+        m_ReadAheadHeader = header;
+        m_ReadAheadData = header + READ_AHEAD_HEADER_SIZE;
+        m_ReadAheadCapacity = capacity - READ_AHEAD_HEADER_SIZE;
+    }
+
+    env->DeleteLocalRef(buffer);
+}
+
 bool CJavaInputStreamCallbacks::NeedBuffer()
 {
     bool result = false;
@@ -163,6 +242,9 @@ bool CJavaInputStreamCallbacks::NeedBuffer()
 
 int CJavaInputStreamCallbacks::ReadNextBlock()
 {
+    if (m_ReadAheadHeader)
+        return ReadAheadNextBlock();
+
     int result = -1;
     CJavaEnvironment javaEnv(m_jvm);
     JNIEnv *pEnv = javaEnv.getEnvironment();
@@ -201,8 +283,93 @@ int CJavaInputStreamCallbacks::ReadBlock(int64_t position, int size)
     return result;
 }
 
+int CJavaInputStreamCallbacks::ReadAheadNextBlock()
+{
+    int64_t readCount = ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_READ_COUNT_OFFSET);
+    int64_t available = ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_WRITE_COUNT_OFFSET) - readCount;
+
+    while (available <= 0)
+    {
+        int64_t state = ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_STATE_OFFSET);
+
+        // Producer stores data before the final state, so check data once more.
+        available = ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_WRITE_COUNT_OFFSET) - readCount;
+        if (available > 0)
+            break;
+
+        if (READ_AHEAD_STATE_EOS == state)
+            return -1;
+        else if (READ_AHEAD_STATE_RUNNING != state)
+            return -2;
+
+        ReadAheadStore(m_ReadAheadHeader, READ_AHEAD_STALL_COUNT_OFFSET,
+                       ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_STALL_COUNT_OFFSET) + 1);
+
+        CJavaEnvironment javaEnv(m_jvm);
+        JNIEnv *pEnv = javaEnv.getEnvironment();
+        if (!pEnv)
+            return -2;
+
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (!connection)
+            return -2;
+
+        pEnv->CallVoidMethod(connection, m_WaitForReadAheadMID);
+        pEnv->DeleteLocalRef(connection);
+        if (javaEnv.clearException())
+            return -2;
+
+        available = ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_WRITE_COUNT_OFFSET) - readCount;
+    }
+
+    return (int)(available < READ_AHEAD_BLOCK_SIZE ? available : READ_AHEAD_BLOCK_SIZE);
+}
+
+void CJavaInputStreamCallbacks::ReadAheadCopyBlock(void* destination, int size)
+{
+    int64_t readCount = ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_READ_COUNT_OFFSET);
+    int64_t offset = readCount % m_ReadAheadCapacity;
+    int64_t first = m_ReadAheadCapacity - offset;
+
+    if (first >= size)
+    {
+        memcpy(destination, m_ReadAheadData + offset, size);
+    }
+    else
+    {
+        memcpy(destination, m_ReadAheadData + offset, (size_t)first);
+        memcpy((uint8_t*)destination + first, m_ReadAheadData, (size_t)(size - first));
+    }
+
+    // Hands the space back to the producer.
+    ReadAheadStore(m_ReadAheadHeader, READ_AHEAD_READ_COUNT_OFFSET, readCount + size);
+
+    // Producer sets the flag before it checks for space, so it is either
+    // seen here or the producer sees the space freed above.
+    if (0 == ReadAheadLoad(m_ReadAheadHeader, READ_AHEAD_PRODUCER_WAITING_OFFSET))
+        return;
+
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            pEnv->CallVoidMethod(connection, m_ReadAheadSpaceAvailableMID);
+            pEnv->DeleteLocalRef(connection);
+        }
+
+        javaEnv.clearException();
+    }
+}
+
 void CJavaInputStreamCallbacks::CopyBlock(void* destination, int size)
 {
+    if (m_ReadAheadHeader)
+    {
+        ReadAheadCopyBlock(destination, size);
+        return;
+    }
+
     CJavaEnvironment javaEnv(m_jvm);
     JNIEnv *pEnv = javaEnv.getEnvironment();
     if (pEnv) {
@@ -277,6 +444,11 @@ void CJavaInputStreamCallbacks::CloseConnection()
     CJavaEnvironment javaEnv(m_jvm);
     JNIEnv *pEnv = javaEnv.getEnvironment();
 
+    // Ring memory may go away together with the connection holder.
+    m_ReadAheadHeader = NULL;
+    m_ReadAheadData = NULL;
+    m_ReadAheadCapacity = 0;
+
     if (pEnv) {
         jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
         if (connection) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,8 +27,24 @@
 #define _JAVA_INPUT_STREAM_CALLBACKS_H_
 
 #include <jni.h>
+#include <stdint.h>
 #include <Locator/LocatorStream.h>
 
+// Layout of the read-ahead buffer header, must match ReadAheadBuffer.java
+#define READ_AHEAD_WRITE_COUNT_OFFSET      0
+#define READ_AHEAD_READ_COUNT_OFFSET       8
+#define READ_AHEAD_STATE_OFFSET            16
+#define READ_AHEAD_STALL_COUNT_OFFSET      24
+#define READ_AHEAD_PRODUCER_WAITING_OFFSET 32
+#define READ_AHEAD_HEADER_SIZE             64
+
+#define READ_AHEAD_STATE_RUNNING      0
+#define READ_AHEAD_STATE_EOS          1
+#define READ_AHEAD_STATE_ERROR        2
+
+// Largest block handed to the source element at once in read-ahead mode
+#define READ_AHEAD_BLOCK_SIZE         65536
+
 class CJavaInputStreamCallbacks : public CStreamCallbacks
 {
 public:
@@ -48,8 +64,17 @@ virtual ~CJavaInputStreamCallbacks();
     int  Property(int prop, int value);
 
 private:
+    void StartReadAhead(JNIEnv *env);
+    int  ReadAheadNextBlock();
+    void ReadAheadCopyBlock(void* destination, int size);
+
     jobject          m_ConnectionHolder;
 
+    // Read-ahead ring filled by Java, NULL if not used
+    uint8_t          *m_ReadAheadHeader;
+    uint8_t          *m_ReadAheadData;
+    int64_t          m_ReadAheadCapacity;
+
     JavaVM           *m_jvm;
     static jfieldID  m_BufferFID;
     static jmethodID m_NeedBufferMID;
@@ -60,6 +85,9 @@ private:
     static jmethodID m_SeekMID;
     static jmethodID m_CloseConnectionMID;
     static jmethodID m_PropertyMID;
+    static jmethodID m_StartReadAheadMID;
+    static jmethodID m_WaitForReadAheadMID;
+    static jmethodID m_ReadAheadSpaceAvailableMID;
 };
 
 #endif // _JAVA_INPUT_STREAM_CALLBACKS_H_
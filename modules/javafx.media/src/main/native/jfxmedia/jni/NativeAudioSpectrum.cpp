@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,7 +51,7 @@ Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetEnabled(JNIEnv *env
 
 JNIEXPORT void JNICALL
 Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetBands(JNIEnv *env, jobject obj, jlong nativeRef,
-                                                                                jint bands, jfloatArray magnitudes, jfloatArray phases)
+                                                                                jint bands, jobject buffer)
 {
     CAudioSpectrum *pSpectrum = (CAudioSpectrum*)jlong_to_ptr(nativeRef);
     CJavaBandsHolder *pHolder = new (std::nothrow) CJavaBandsHolder();
@@ -59,7 +59,7 @@ Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetBands(JNIEnv *env,
         return;
     }
 
-    if (!pHolder->Init(env, bands, magnitudes, phases)) {
+    if (!pHolder->Init(env, bands, buffer)) {
         delete pHolder;
         pHolder = NULL;
     }
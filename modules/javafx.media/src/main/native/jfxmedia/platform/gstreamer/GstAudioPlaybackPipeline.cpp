@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1518,26 +1518,8 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
                 if (!gst_structure_get_clock_time (pStr, "duration", &duration))
                     duration = GST_CLOCK_TIME_NONE;
 
-                size_t bandsNum = pPipeline->GetAudioSpectrum()->GetBands();
-
-                if (bandsNum > 0)
-                {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
-                    const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-                    const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-                    for (int i=0; i < bandsNum; i++)
-                    {
-                        magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
-                    }
-                    pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
-
-                    delete [] magnitudes;
-                    delete [] phases;
-                }
-
+                // Band values were delivered from the streaming thread by
+                // CGstAudioSpectrum, only the event is dispatched from here.
                 if (!pPipeline->m_pEventDispatcher->SendAudioSpectrumEvent(GST_TIME_AS_SECONDS((double)timestamp),
                     GST_TIME_AS_SECONDS((double)duration), false)) // Always false, since GStreamer does not need it,
                                                                    // but if it will be required such case needs to be
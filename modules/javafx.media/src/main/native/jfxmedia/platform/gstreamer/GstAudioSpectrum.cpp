@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -63,10 +63,15 @@ CGstAudioSpectrum::CGstAudioSpectrum(GstElement* pSpectrum, bool enabled)
                               "message-magnitude", TRUE,
                               "message-phase", TRUE, NULL);
     g_atomic_pointer_set(&m_pHolder, NULL);
+
+    // Take band values on the streaming thread instead of parsing bus messages
+    m_BandsHandlerId = g_signal_connect(m_pSpectrum, "bands", G_CALLBACK(OnBands), this);
 }
 
 CGstAudioSpectrum::~CGstAudioSpectrum()
 {
+    if (m_BandsHandlerId != 0)
+        g_signal_handler_disconnect(m_pSpectrum, m_BandsHandlerId);
     CBandsHolder::ReleaseRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
     gst_object_unref(m_pSpectrum);
 }
@@ -102,10 +107,32 @@ void CGstAudioSpectrum::SetBands(int bands, CBandsHolder* holder)
 void CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
     CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
-    holder->UpdateBands(size, magnitudes, phases);
+    if (holder != NULL)
+        holder->UpdateBands(size, magnitudes, phases);
     CBandsHolder::ReleaseRef(holder);
 }
 
+void CGstAudioSpectrum::OnBands(GstElement* element, guint64 timestamp, guint64 duration, guint bands,
+                                gpointer magnitudes, gpointer phases, CGstAudioSpectrum* pSpectrum)
+{
+    CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&pSpectrum->m_pHolder));
+    if (holder == NULL)
+        return;
+
+    holder->UpdateBands((int)bands, (const float*)magnitudes, (const float*)phases);
+    bool notify = holder->RequestNotification();
+    CBandsHolder::ReleaseRef(holder);
+
+    if (notify)
+    {
+        // Band values are already in the holder, the bus only carries timing
+        GstStructure *pStr = gst_structure_new("spectrum",
+                                               "timestamp", G_TYPE_UINT64, timestamp,
+                                               "duration", G_TYPE_UINT64, duration, NULL);
+        gst_element_post_message(element, gst_message_new_element(GST_OBJECT(element), pStr));
+    }
+}
+
 double CGstAudioSpectrum::GetInterval()
 {
     guint64 interval;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,7 +49,11 @@ public:
     virtual void      SetThreshold(int threshold);
 
 private:
+    static void       OnBands(GstElement* element, guint64 timestamp, guint64 duration, guint bands,
+                              gpointer magnitudes, gpointer phases, CGstAudioSpectrum* pSpectrum);
+
     GstElement*            m_pSpectrum;
+    gulong                 m_BandsHandlerId;
     volatile CBandsHolder* m_pHolder;
 };
 
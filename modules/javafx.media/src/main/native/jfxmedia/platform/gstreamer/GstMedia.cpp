@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -110,6 +110,8 @@ extern "C" {
             return ERROR_MEMORY_ALLOCATION;
         }
 
+        locator->SetDecoderThreadCount(CLocator::LocatorGetDecoderThreadCount(env, jLocator));
+
         // Load any additional streams if needed.
         // HLS_PROP_HAS_AUDIO_EXT_STREAM
         int hasAudioStream = callbacks->Property(HLS_PROP_HAS_AUDIO_EXT_STREAM, 0);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -83,6 +83,7 @@ uint32_t CGstPipelineFactory::CreatePlayerPipeline(CLocator* locator, CPipelineO
 
     // Save content type to options
     pOptions->SetContentType(locator->GetContentType());
+    pOptions->SetVideoDecoderThreadCount(locator->GetDecoderThreadCount());
 
     CLocatorStream* streamLocator = (CLocatorStream*)locator;
     CStreamCallbacks *callbacks = streamLocator->GetCallbacks();
@@ -811,6 +812,14 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    // Only libav based decoder supports threading configuration.
+    GstElement *videodec = (*pElements)[VIDEO_DECODER];
+    if (NULL != videodec &&
+        NULL != g_object_class_find_property(G_OBJECT_GET_CLASS(videodec), "thread-count"))
+    {
+        g_object_set(videodec, "thread-count", (gint)pOptions->GetVideoDecoderThreadCount(), NULL);
+    }
+
     pElements->add(PIPELINE, pipeline);
     pElements->add(AV_DEMUXER, demuxer);
     if (audioDemuxer != NULL)
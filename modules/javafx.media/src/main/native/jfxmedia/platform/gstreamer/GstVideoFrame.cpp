@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,36 +41,114 @@ static inline guint32 swap_uint32(guint32 x)
         ((x & 0xff000000U) >> 24);
 }
 
+// Frames are converted for every displayed frame when the renderer can not use
+// YCbCr textures. Keep a few released buffers around while a video pipeline is
+// alive, so steady playback does not allocate and free a full RGB frame each
+// time.
+#define MAX_POOLED_BUFFERS  4
+#define MAX_POOLED_BYTES    (128 * 1024 * 1024)
+
+typedef struct
+{
+    guint8 *data; // allocated memory, 16 bytes bigger than size
+    guint   size; // usable size
+} AlignedAllocation;
+
+G_LOCK_DEFINE_STATIC(pool_lock);
+static GSList *pooled_allocations = NULL; // most recently released first
+static guint   pooled_count = 0;
+static guint   pooled_bytes = 0;
+static guint   pool_users = 0; // live video pipelines
+
+static void free_allocation(gpointer ptr)
+{
+    AlignedAllocation *allocation = (AlignedAllocation*)ptr;
+    g_free(allocation->data);
+    g_free(allocation);
+}
+
 static void free_aligned_buffer(gpointer ptr)
 {
-    if (ptr != NULL) {
-        g_free(ptr);
+    AlignedAllocation *allocation = (AlignedAllocation*)ptr;
+    GSList *evicted = NULL;
+
+    if (allocation == NULL) {
+        return;
+    }
+
+    if (allocation->size > MAX_POOLED_BYTES) {
+        free_allocation(allocation);
+        return;
     }
+
+    G_LOCK(pool_lock);
+    if (pool_users == 0) {
+        // Frames can outlive their pipeline; nothing will reuse these
+        G_UNLOCK(pool_lock);
+        free_allocation(allocation);
+        return;
+    }
+
+    // Drop least recently released buffers to make room
+    while (pooled_allocations != NULL &&
+           (pooled_count >= MAX_POOLED_BUFFERS || pooled_bytes + allocation->size > MAX_POOLED_BYTES)) {
+        GSList *last = g_slist_last(pooled_allocations);
+        AlignedAllocation *oldest = (AlignedAllocation*)last->data;
+        pooled_allocations = g_slist_delete_link(pooled_allocations, last);
+        pooled_count--;
+        pooled_bytes -= oldest->size;
+        evicted = g_slist_prepend(evicted, oldest);
+    }
+    pooled_allocations = g_slist_prepend(pooled_allocations, allocation);
+    pooled_count++;
+    pooled_bytes += allocation->size;
+    G_UNLOCK(pool_lock);
+
+    g_slist_free_full(evicted, free_allocation);
 }
 
 static GstBuffer *alloc_aligned_buffer(guint size)
 {
     // allocate a new GstBuffer of the given size plus some for padding and alignment
-    guint8 *newData;
+    AlignedAllocation *allocation = NULL;
     guint8 *alignedData;
-    guint alignedSize;
-
-    // allocate a buffer large enough to accommodate 16 byte alignment
-    alignedSize = size;
-    if (size <= (G_MAXUINT - 16)) {
-        size += 16;
-    } else {
-        return NULL;
+    GSList *item;
+
+    // reuse released buffer of the same size if there is one
+    G_LOCK(pool_lock);
+    for (item = pooled_allocations; item != NULL; item = item->next) {
+        if (((AlignedAllocation*)item->data)->size == size) {
+            allocation = (AlignedAllocation*)item->data;
+            pooled_allocations = g_slist_delete_link(pooled_allocations, item);
+            pooled_count--;
+            pooled_bytes -= size;
+            break;
+        }
     }
+    G_UNLOCK(pool_lock);
 
-    newData = (guint8*)g_try_malloc(size);
-    if (NULL == newData) {
-        return NULL;
+    if (NULL == allocation) {
+        // allocate a buffer large enough to accommodate 16 byte alignment
+        if (size > (G_MAXUINT - 16)) {
+            return NULL;
+        }
+
+        allocation = g_try_new(AlignedAllocation, 1);
+        if (NULL == allocation) {
+            return NULL;
+        }
+
+        allocation->data = (guint8*)g_try_malloc(size + 16);
+        if (NULL == allocation->data) {
+            g_free(allocation);
+            return NULL;
+        }
+        allocation->size = size;
     }
 
-    alignedData = (guint8*)(((intptr_t)newData + 15) & ~15);
+    alignedData = (guint8*)(((intptr_t)allocation->data + 15) & ~15);
 
-    return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
+    return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, size, 0, size, allocation, free_aligned_buffer);
 }
 
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
@@ -108,6 +186,29 @@ GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height,
     return newCaps;
 }
 
+void CGstVideoFrame::AddPoolUser()
+{
+    G_LOCK(pool_lock);
+    pool_users++;
+    G_UNLOCK(pool_lock);
+}
+
+void CGstVideoFrame::RemovePoolUser()
+{
+    GSList *drained = NULL;
+
+    G_LOCK(pool_lock);
+    if (pool_users > 0 && --pool_users == 0) {
+        drained = pooled_allocations;
+        pooled_allocations = NULL;
+        pooled_count = 0;
+        pooled_bytes = 0;
+    }
+    G_UNLOCK(pool_lock);
+
+    g_slist_free_full(drained, free_allocation);
+}
+
 CGstVideoFrame::CGstVideoFrame()
 {
     m_bIsValid = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,6 +58,14 @@ public:
 
     virtual CVideoFrame *ConvertToFormat(FrameType type);
 
+    /*
+     * Video pipelines register while they are alive. Converted frame buffers
+     * are pooled for reuse only while there is at least one, and the pool is
+     * freed when the last one goes away.
+     */
+    static void AddPoolUser();
+    static void RemovePoolUser();
+
 private:
     void SetFrameCaps(GstCaps *newCaps);
 
@@ -190,8 +190,9 @@ void AVFAudioSpectrumUnit::UpdateBands(int size, const float* magnitudes, const
     // Update band data
     mBands->UpdateBands(size, magnitudes, magnitudes);
 
-    // Call our listener to dispatch the spectrum event
-    if (mSpectrumCallbackProc) {
+    // Call our listener to dispatch the spectrum event, unless Java has not
+    // consumed the previous one yet; it will read these bands with it.
+    if (mSpectrumCallbackProc && mBands->RequestNotification()) {
         double duration = (double) mSamplesPerInterval / (double) 44100;
         // We do not provide timestamp here. It will be queried from EventQueueThread
         // due to reading current time from AVPlayer might hang when called
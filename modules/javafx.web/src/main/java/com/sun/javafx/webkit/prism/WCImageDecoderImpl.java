@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,10 +37,11 @@ import com.sun.webkit.graphics.WCGraphicsManager;
 import com.sun.webkit.graphics.WCImage;
 import com.sun.webkit.graphics.WCImageDecoder;
 import com.sun.webkit.graphics.WCImageFrame;
-import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -57,8 +58,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
-    private volatile byte[] data;
-    private volatile int dataSize = 0;
+    // Direct views of the native image data, see WCImageDecoder.addImageData.
+    // Guarded by dataLock, so that receiving data does not wait for decoding.
+    private final Object dataLock = new Object();
+    private List<ByteBuffer> data = new ArrayList<>();
+    private int dataSize = 0;
     private String fileNameExtension;
 
     static {
@@ -80,6 +84,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         frames = null;
         images = null;
         framesDecoded = false;
+        // The native data is released once this method returns.
+        synchronized (dataLock) {
+            data = null;
+            dataSize = 0;
+        }
     }
 
     @Override protected String getFilenameExtension() {
@@ -90,30 +99,27 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
-            fullDataReceived = false;
-            if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
-            } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
+            synchronized (dataLock) {
+                if (data == null) {
+                    return;
                 }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                fullDataReceived = false;
+                data.add(dataPortion.asReadOnlyBuffer());
+                dataSize += dataPortion.remaining();
             }
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
                 loadFrames();
             }
-        } else if (data != null && !fullDataReceived) {
-            // null dataPortion means data completion
-            if (data.length > dataSize) {
-                resizeDataArray(dataSize);
+        } else {
+            synchronized (dataLock) {
+                // null dataPortion means data completion
+                if (dataSize > 0) {
+                    fullDataReceived = true;
+                }
             }
-            fullDataReceived = true;
         }
     }
 
@@ -148,12 +154,6 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private void resizeDataArray(int newDataSize) {
-        byte[] newData = new byte[newDataSize];
-        System.arraycopy(data, 0, newData, 0, dataSize);
-        data = newData;
-    }
-
     @Override protected void loadFromResource(String name) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format(
@@ -190,8 +190,78 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private ImageFrame[] loadFrames() {
-        return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize));
+    // Synchronized with destroy() so that the native data cannot be
+    // released while it is being decoded.
+    private synchronized ImageFrame[] loadFrames() {
+        final InputStream in;
+        synchronized (dataLock) {
+            if (data == null || data.isEmpty()) {
+                return null;
+            }
+            in = new ByteBufferListInputStream(data);
+        }
+        return loadFrames(in);
+    }
+
+    /*
+     * Reads the received portions of image data in place. Each stream
+     * works on its own duplicates of the buffers, so the data can be
+     * decoded repeatedly while more portions are being received.
+     */
+    private static final class ByteBufferListInputStream extends InputStream {
+        private final ByteBuffer[] buffers;
+        private int current = 0;
+
+        private ByteBufferListInputStream(List<ByteBuffer> data) {
+            buffers = new ByteBuffer[data.size()];
+            for (int i = 0; i < buffers.length; i++) {
+                buffers[i] = data.get(i).duplicate();
+            }
+        }
+
+        private ByteBuffer currentBuffer() {
+            while (current < buffers.length && !buffers[current].hasRemaining()) {
+                current++;
+            }
+            return current < buffers.length ? buffers[current] : null;
+        }
+
+        @Override public int read() {
+            ByteBuffer buffer = currentBuffer();
+            return buffer != null ? buffer.get() & 0xFF : -1;
+        }
+
+        @Override public int read(byte[] b, int off, int len) {
+            if (len == 0) {
+                return 0;
+            }
+            ByteBuffer buffer = currentBuffer();
+            if (buffer == null) {
+                return -1;
+            }
+            int n = Math.min(len, buffer.remaining());
+            buffer.get(b, off, n);
+            return n;
+        }
+
+        @Override public long skip(long n) {
+            long skipped = 0;
+            ByteBuffer buffer;
+            while (skipped < n && (buffer = currentBuffer()) != null) {
+                int step = (int) Math.min(n - skipped, buffer.remaining());
+                buffer.position(buffer.position() + step);
+                skipped += step;
+            }
+            return skipped;
+        }
+
+        @Override public int available() {
+            long available = 0;
+            for (int i = current; i < buffers.length; i++) {
+                available += buffers[i].remaining();
+            }
+            return (int) Math.min(available, Integer.MAX_VALUE);
+        }
     }
 
     private final ImageLoadListener readerListener = new ImageLoadListener() {
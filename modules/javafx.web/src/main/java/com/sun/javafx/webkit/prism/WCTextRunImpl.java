@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,8 @@ package com.sun.javafx.webkit.prism;
 import com.sun.javafx.scene.text.GlyphList;
 import com.sun.javafx.text.TextRun;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 public final class WCTextRunImpl implements WCTextRun {
     private final TextRun run;
@@ -78,4 +80,29 @@ public final class WCTextRunImpl implements WCTextRun {
     public int getCharOffset(int index) {
         return run.getCharOffset(index);
     }
+
+    @Override
+    public int getGlyphData(ByteBuffer buffer) {
+        int count = run.getGlyphCount();
+        if (buffer.capacity() < GLYPH_DATA_HEADER_SIZE + count * GLYPH_DATA_SIZE) {
+            return count;
+        }
+
+        buffer.order(ByteOrder.nativeOrder());
+        buffer.putInt(0, count);
+        buffer.putInt(4, run.getStart());
+        buffer.putInt(8, run.getEnd());
+        buffer.putInt(12, run.isLeftToRight() ? 1 : 0);
+
+        int offset = GLYPH_DATA_HEADER_SIZE;
+        for (int i = 0; i < count; i++) {
+            buffer.putInt(offset, run.getGlyphCode(i));
+            buffer.putInt(offset + 4, run.getCharOffset(i));
+            buffer.putFloat(offset + 8, run.getPosX(i));
+            buffer.putFloat(offset + 12, run.getPosY(i));
+            buffer.putFloat(offset + 16, run.getAdvance(i));
+            offset += GLYPH_DATA_SIZE;
+        }
+        return count;
+    }
 }
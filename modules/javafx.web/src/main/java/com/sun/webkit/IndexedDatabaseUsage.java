@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * IndexedDB disk usage of one origin, as seen by the per-origin quota of a
+ * {@link WebPage}. The size is measured by scanning the origin's database
+ * directory, plus the space granted since the last scan.
+ *
+ * @param origin the origin that stored the data
+ * @param topOrigin the origin of the top level document it was stored from
+ * @param bytes estimated bytes in use
+ * @param quota per-origin quota in bytes
+ * @param scanCount number of times the directory was scanned
+ * @param scanMillis total time spent scanning, in milliseconds
+ * @param deniedRequests number of writes denied for exceeding the quota
+ */
+public record IndexedDatabaseUsage(String origin, String topOrigin,
+        long bytes, long quota, int scanCount, double scanMillis,
+        int deniedRequests) {
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -90,6 +90,10 @@ public final class WebPage {
     // yet or had been already disposed - in both cases pPage is 0
     private boolean isDisposed = false;
 
+    // Whether IndexedDB databases are stored on disk, see
+    // setIndexedDatabaseDirectory
+    private volatile boolean indexedDatabasePersistent = false;
+
     private int width, height;
 
     private int fontSmoothingType;
@@ -1184,6 +1188,24 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Returns the number of rendering queue buffers taken from the page's
+     * buffer pool and the number of buffers that had to be allocated
+     * because the pool was empty, in that order.
+     */
+    public long[] getRenderBufferPoolStatistics() {
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("getRenderBufferPoolStatistics() request for a disposed web page.");
+                return new long[2];
+            }
+            return twkGetRenderBufferPoolStatistics(getPage());
+        } finally {
+            unlockPage();
+        }
+    }
+
     // DRT support
     public void forceRepaint() {
         repaintAll();
@@ -2071,6 +2093,65 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory this page stores its IndexedDB databases in. It
+     * only takes effect if set before the page opens its first database;
+     * until then databases are kept in memory. The per-origin quota, in
+     * bytes, is read from the {@code com.sun.webkit.indexedDBQuota} system
+     * property.
+     *
+     * @return {@code false} if this platform keeps the databases in memory
+     *         regardless, see {@link #isIndexedDatabasePersistent()}
+     */
+    public boolean setIndexedDatabaseDirectory(String path) {
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("setIndexedDatabaseDirectory() request for a disposed web page.");
+                return false;
+            }
+            indexedDatabasePersistent = twkSetIndexedDatabaseDirectory(getPage(), path,
+                    Long.getLong("com.sun.webkit.indexedDBQuota", 0L));
+            if (!indexedDatabasePersistent) {
+                log.warning("IndexedDB databases are kept in memory on this platform, "
+                        + "they are not stored in " + path);
+            }
+            return indexedDatabasePersistent;
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns {@code true} if the IndexedDB databases of this page are
+     * stored in the directory set with
+     * {@link #setIndexedDatabaseDirectory(String)}, {@code false} if they
+     * are kept in memory and lost when the page is disposed. The file system
+     * calls the database backend needs are only implemented on Linux.
+     */
+    public boolean isIndexedDatabasePersistent() {
+        return indexedDatabasePersistent;
+    }
+
+    /**
+     * Returns the IndexedDB disk usage of every origin that stored data in
+     * the directory since it was set, including the time spent measuring
+     * it. The array is empty if the databases are kept in memory.
+     */
+    public IndexedDatabaseUsage[] getIndexedDatabaseUsage() {
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("getIndexedDatabaseUsage() request for a disposed web page.");
+                return new IndexedDatabaseUsage[0];
+            }
+            IndexedDatabaseUsage[] usage = twkGetIndexedDatabaseUsage(getPage());
+            return usage != null ? usage : new IndexedDatabaseUsage[0];
+        } finally {
+            unlockPage();
+        }
+    }
+
     public void setLocalStorageEnabled(boolean enabled) {
         lockPage();
         try {
@@ -2080,6 +2161,41 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory used to cache the bytecode of external scripts.
+     * A {@code null} path disables the cache.
+     */
+    public void setBytecodeCacheDirectory(String path) {
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("setBytecodeCacheDirectory() request for a disposed web page.");
+                return;
+            }
+            twkSetBytecodeCacheDirectory(getPage(), path);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the number of scripts whose bytecode was found in the
+     * bytecode cache and the number of scripts that had to be compiled
+     * from source, in that order.
+     */
+    public long[] getBytecodeCacheStatistics() {
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("getBytecodeCacheStatistics() request for a disposed web page.");
+                return new long[2];
+            }
+            return twkGetBytecodeCacheStatistics(getPage());
+        } finally {
+            unlockPage();
+        }
+    }
+
     // ---- INSPECTOR SUPPORT ---- //
 
     public void connectInspectorFrontend() {
@@ -2590,6 +2706,12 @@ public final class WebPage {
         return frames.size();
     }
 
+    // Package scope method for testing
+    static void test_releaseMemory() {
+        Invoker.getInvoker().checkEventThread();
+        twkReleaseMemory();
+    }
+
     // *************************************************************************
     // Native methods
     // *************************************************************************
@@ -2646,6 +2768,7 @@ public final class WebPage {
     private native float twkAdjustFrameHeight(long pFrame, float oldTop, float oldBottom, float bottomLimit);
 
     private native int[] twkGetVisibleRect(long pFrame);
+    private native long[] twkGetRenderBufferPoolStatistics(long pPage);
     private native void twkScrollToPosition(long pFrame, int x, int y);
     private native int[] twkGetContentSize(long pFrame);
     private native void twkSetTransparent(long pFrame, boolean isTransparent);
@@ -2716,6 +2839,10 @@ public final class WebPage {
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
+    private native boolean twkSetIndexedDatabaseDirectory(long page, String path, long perOriginQuota);
+    private native IndexedDatabaseUsage[] twkGetIndexedDatabaseUsage(long page);
+    private native void twkSetBytecodeCacheDirectory(long page, String path);
+    private native long[] twkGetBytecodeCacheStatistics(long page);
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
 
@@ -2724,4 +2851,5 @@ public final class WebPage {
     private native void twkDispatchInspectorMessageFromFrontend(long pPage,
                                                                 String message);
     private static native void twkDoJSCGarbageCollection();
+    private static native void twkReleaseMemory();
 }
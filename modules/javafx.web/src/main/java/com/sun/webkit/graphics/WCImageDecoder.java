@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,21 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
     /**
      * Receives a portion of image data.
+     * <p>
+     * The buffer is a direct view of the native image data, it is not
+     * copied. It stays valid until {@link #destroy()} is called and must
+     * not be accessed afterwards.
      *
      * @param data  a portion of image data,
      *              or {@code null} if all data received
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data);
 
     /**
      * Returns image size.
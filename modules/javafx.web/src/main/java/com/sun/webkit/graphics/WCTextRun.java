@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,14 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
+
 public interface WCTextRun {
+    /** Size of the run header written by {@link #getGlyphData}. */
+    int GLYPH_DATA_HEADER_SIZE = 16;
+    /** Size of each glyph record written by {@link #getGlyphData}. */
+    int GLYPH_DATA_SIZE = 20;
+
     boolean isLeftToRight();
     float[] getGlyphPosAndAdvance(int glyphIndex);
     int getCharOffset(int index);
@@ -33,4 +40,15 @@ public interface WCTextRun {
     int getGlyph(int index);
     int getGlyphCount();
     int getStart();
+
+    /**
+     * Writes the whole run into {@code buffer} in native byte order, so
+     * that it can be read with a single call. The header holds the glyph
+     * count, start, end and 1 for left to right runs, followed by the glyph
+     * code, char offset, x, y and advance of each glyph. Nothing is written
+     * if the buffer cannot hold all the glyphs.
+     *
+     * @return the number of glyphs in the run
+     */
+    int getGlyphData(ByteBuffer buffer);
 }
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import java.net.InetAddress;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
+import java.net.UnknownHostException;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.webkit.Invoker;
+
+/**
+ * Resolves host names for WebCore's DNS prefetching and resolve requests.
+ * Lookups go through {@link InetAddress}, so their results land in the
+ * same address cache, bounded by {@code networkaddress.cache.ttl}, that
+ * the loaders use when they connect. Concurrent lookups of the same host
+ * share a single resolution.
+ */
+final class DNSResolver {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(DNSResolver.class.getName());
+
+    /**
+     * The size of the resolver thread pool. WebCore never has more than
+     * a few prefetches in flight.
+     */
+    private static final int THREAD_POOL_SIZE = 4;
+
+    /**
+     * The thread pool keep alive time.
+     */
+    private static final long THREAD_POOL_KEEP_ALIVE_TIME = 10000L;
+
+    /**
+     * The address used to check whether requests go through a proxy.
+     */
+    private static final URI PROXY_CHECK_URI = URI.create("http://example.com/");
+
+    /**
+     * Resolves a single host name.
+     */
+    interface Resolver {
+        InetAddress[] resolve(String host) throws UnknownHostException;
+    }
+
+    private static final ThreadPoolExecutor threadPool;
+    static {
+        threadPool = new ThreadPoolExecutor(
+                THREAD_POOL_SIZE,
+                THREAD_POOL_SIZE,
+                THREAD_POOL_KEEP_ALIVE_TIME,
+                TimeUnit.MILLISECONDS,
+                new LinkedBlockingQueue<Runnable>(),
+                new DNSResolverThreadFactory());
+        threadPool.allowCoreThreadTimeOut(true);
+    }
+
+    /**
+     * Lookups in progress, by host name.
+     */
+    private static final Map<String, CompletableFuture<InetAddress[]>> lookups =
+            new ConcurrentHashMap<>();
+
+    /**
+     * Identifiers of the resolve requests that have not been answered
+     * or cancelled yet.
+     */
+    private static final Set<Long> requests = ConcurrentHashMap.newKeySet();
+
+    private static volatile Resolver resolver = InetAddress::getAllByName;
+
+    /**
+     * Non-invocable constructor.
+     */
+    private DNSResolver() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Replaces the resolver, so that tests can run against a stub.
+     */
+    static void setResolver(Resolver r) {
+        resolver = r != null ? r : InetAddress::getAllByName;
+    }
+
+    /**
+     * Returns the lookup of {@code host}, starting one unless it is
+     * already in progress.
+     */
+    static CompletableFuture<InetAddress[]> lookup(String host) {
+        CompletableFuture<InetAddress[]> lookup = lookups.get(host);
+        if (lookup != null) {
+            return lookup;
+        }
+
+        CompletableFuture<InetAddress[]> newLookup = new CompletableFuture<>();
+        lookup = lookups.putIfAbsent(host, newLookup);
+        if (lookup != null) {
+            return lookup;
+        }
+
+        threadPool.execute(() -> {
+            try {
+                newLookup.complete(resolver.resolve(host));
+            } catch (Throwable t) {
+                if (logger.isLoggable(Level.FINE)) {
+                    logger.fine(String.format("Failed to resolve [%s]: %s", host, t));
+                }
+                newLookup.completeExceptionally(t);
+            } finally {
+                lookups.remove(host, newLookup);
+            }
+        });
+        return newLookup;
+    }
+
+    /**
+     * Resolves {@code host} ahead of a load, called by
+     * DNSResolveQueue when a prefetch is sent out.
+     */
+    private static void fwkPrefetch(String host) {
+        lookup(host).whenComplete((addresses, t) ->
+                Invoker.getInvoker().postOnEventThread(() -> twkDidPrefetch()));
+    }
+
+    /**
+     * Resolves {@code host} and reports its addresses to WebCore.
+     */
+    private static void fwkResolve(String host, long identifier) {
+        requests.add(identifier);
+        lookup(host).whenComplete((addresses, t) -> {
+            if (!requests.remove(identifier)) {
+                return;
+            }
+            String[] result = null;
+            if (addresses != null) {
+                result = new String[addresses.length];
+                for (int i = 0; i < addresses.length; i++) {
+                    result[i] = addresses[i].getHostAddress();
+                }
+            }
+            final String[] hostAddresses = result;
+            Invoker.getInvoker().postOnEventThread(
+                    () -> twkDidResolve(identifier, hostAddresses));
+        });
+    }
+
+    /**
+     * Drops a resolve request, its lookup carries on for other requests.
+     */
+    private static void fwkCancel(long identifier) {
+        requests.remove(identifier);
+    }
+
+    /**
+     * Returns whether loads go through a proxy, in which case resolving
+     * names locally does not help them.
+     */
+    private static boolean fwkIsUsingProxy() {
+        ProxySelector proxySelector = ProxySelector.getDefault();
+        if (proxySelector == null) {
+            return false;
+        }
+        try {
+            for (Proxy proxy : proxySelector.select(PROXY_CHECK_URI)) {
+                if (proxy.type() != Proxy.Type.DIRECT) {
+                    return true;
+                }
+            }
+        } catch (RuntimeException ex) {
+            return true;
+        }
+        return false;
+    }
+
+    private static native void twkDidPrefetch();
+
+    private static native void twkDidResolve(long identifier, String[] addresses);
+
+    /**
+     * Thread factory for resolver threads.
+     */
+    private static final class DNSResolverThreadFactory implements ThreadFactory {
+        private final ThreadGroup group;
+        private final AtomicInteger index = new AtomicInteger(1);
+
+        private DNSResolverThreadFactory() {
+            group = Thread.currentThread().getThreadGroup();
+        }
+
+        @Override
+        public Thread newThread(Runnable r) {
+            Thread t = new Thread(group, r, "DNS-Resolver-" + index.getAndIncrement());
+            t.setDaemon(true);
+            if (t.getPriority() != Thread.NORM_PRIORITY) {
+                t.setPriority(Thread.NORM_PRIORITY);
+            }
+            return t;
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -508,21 +508,34 @@ final class HTTP2Loader extends URLLoaderBase {
     }
 
     private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
+        countCopiedBytes(bb.remaining());
         return getDirectBuffer(bb.limit()).put(bb).flip();
     }
 
-    // another variant to use from createZIPEncodedBodySubscriber
+    // another variant to use from createZIPEncodedBodySubscriber; the array
+    // is not reused by the caller, so it is passed to native as is
     private void didReceiveData(final byte[] bytes, int size) {
-        callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
-        });
+        callBackIfNotCanceled(() -> notifyDidReceiveData(bytes, 0, size));
     }
 
+    // Buffers delivered by the HttpClient are not reused once passed to the
+    // subscriber, so direct and array backed ones are passed to native as is
+    // and only the rest go through the shared direct buffer.
     private void didReceiveData(final List<ByteBuffer> bytes) {
-        callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
-                                          .forEach(this::notifyDidReceiveData)
-        );
+        callBackIfNotCanceled(() -> bytes.forEach(bb -> {
+            if (canceled) {
+                return;
+            }
+            if (bb.isDirect()) {
+                notifyDidReceiveData(bb);
+            } else if (bb.hasArray()) {
+                notifyDidReceiveData(bb.array(),
+                                     bb.arrayOffset() + bb.position(),
+                                     bb.remaining());
+            } else {
+                notifyDidReceiveData(copyToDirectBuffer(bb));
+            }
+        }));
     }
 
     private void notifyDidReceiveData(ByteBuffer byteBuffer) {
@@ -538,7 +551,27 @@ final class HTTP2Loader extends URLLoaderBase {
                     byteBuffer.remaining(),
                     data));
         }
-        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), data);
+        deliverData(byteBuffer, byteBuffer.position(),
+                    byteBuffer.remaining(), data);
+    }
+
+    private void notifyDidReceiveData(byte[] bytes, int offset, int length) {
+        Invoker.getInvoker().checkEventThread();
+        if (logger.isLoggable(Level.FINEST)) {
+            logger.finest(String.format(
+                    "offset: [%s], "
+                    + "length: [%s], "
+                    + "data: [0x%016X]",
+                    offset,
+                    length,
+                    data));
+        }
+        if (!deliverData(bytes, offset, length, data)) {
+            // Fail the load rather than hand WebCore a truncated body
+            canceled = true;
+            notifyDidFail(LoadListenerClient.UNKNOWN_ERROR, url,
+                          "Out of memory");
+        }
     }
 
     private void didFinishLoading() {
@@ -550,6 +583,7 @@ final class HTTP2Loader extends URLLoaderBase {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format("data: [0x%016X]", data));
         }
+        logCopiedBytes(logger, url);
         twkDidFinishLoading(data);
     }
 
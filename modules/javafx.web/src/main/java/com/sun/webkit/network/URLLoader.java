@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -518,6 +518,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                         byteBuffer = allocator.allocate();
                     }
 
+                    countCopiedBytes(count);
                     int remaining = byteBuffer.remaining();
                     if (count < remaining) {
                         byteBuffer.put(buffer, 0, count);
@@ -740,7 +741,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     remaining,
                     data));
         }
-        twkDidReceiveData(byteBuffer, position, remaining, data);
+        deliverData(byteBuffer, position, remaining, data);
     }
 
     private void didFinishLoading() {
@@ -755,6 +756,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format("data: [0x%016X]", data));
         }
+        logCopiedBytes(logger, url);
         twkDidFinishLoading(data);
     }
 
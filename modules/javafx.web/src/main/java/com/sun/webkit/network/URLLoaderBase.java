@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,17 +25,77 @@
 
 package com.sun.webkit.network;
 
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
 import java.lang.annotation.Native;
 import java.nio.ByteBuffer;
+import java.util.concurrent.atomic.AtomicLong;
 
 abstract class URLLoaderBase {
     @Native public static final int ALLOW_UNASSIGNED = java.net.IDN.ALLOW_UNASSIGNED;
 
+    /**
+     * The number of response body bytes passed to the native code.
+     */
+    private final AtomicLong bodyBytes = new AtomicLong();
+
+    /**
+     * The number of response body bytes copied on their way to WebCore,
+     * including the copy made by the native code.
+     */
+    private final AtomicLong copiedBytes = new AtomicLong();
+
     /**
      * Cancels the loader.
      */
     protected abstract void fwkCancel();
 
+    /**
+     * Records {@code count} body bytes copied by the loader before they
+     * are passed to the native code.
+     */
+    protected final void countCopiedBytes(int count) {
+        copiedBytes.addAndGet(count);
+    }
+
+    /**
+     * Passes a range of a direct buffer to the native code.
+     */
+    protected final void deliverData(ByteBuffer byteBuffer, int position,
+                                     int remaining, long data)
+    {
+        bodyBytes.addAndGet(remaining);
+        copiedBytes.addAndGet(remaining);
+        twkDidReceiveData(byteBuffer, position, remaining, data);
+    }
+
+    /**
+     * Passes a range of a byte array to the native code.
+     *
+     * @return false if the native code could not access the array, in which
+     *         case the caller must fail the load
+     */
+    protected final boolean deliverData(byte[] bytes, int offset, int length,
+                                        long data)
+    {
+        bodyBytes.addAndGet(length);
+        copiedBytes.addAndGet(length);
+        return twkDidReceiveBytes(bytes, offset, length, data);
+    }
+
+    /**
+     * Logs the body and copy byte counts of the finished response.
+     */
+    protected final void logCopiedBytes(PlatformLogger logger, String url) {
+        if (logger.isLoggable(Level.FINE)) {
+            logger.fine(String.format(
+                    "url: [%s], body bytes: [%d], copied bytes: [%d]",
+                    url,
+                    bodyBytes.get(),
+                    copiedBytes.get()));
+        }
+    }
+
     protected static native void twkDidSendData(long totalBytesSent,
                                               long totalBytesToBeSent,
                                               long data);
@@ -61,6 +121,11 @@ abstract class URLLoaderBase {
                                                  int remaining,
                                                  long data);
 
+    protected static native boolean twkDidReceiveBytes(byte[] bytes,
+                                                     int offset,
+                                                     int length,
+                                                     long data);
+
     protected static native void twkDidFinishLoading(long data);
 
     protected static native void twkDidFail(int errorCode,
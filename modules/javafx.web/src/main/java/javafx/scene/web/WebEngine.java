@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -383,6 +383,12 @@ final public class WebEngine {
 
     private boolean userDataDirectoryApplied = false;
 
+    /**
+     * The directory that stores the bytecode cache, or {@code null}
+     * if no user data directory has been applied.
+     */
+    private File bytecodeCacheDir;
+
 
     /**
      * Returns a {@link javafx.concurrent.Worker} object that can be used to
@@ -497,6 +503,50 @@ final public class WebEngine {
         return javaScriptEnabled;
     }
 
+    /**
+     * Specifies whether the bytecode compiled for external scripts is
+     * cached on disk and reused the next time the same script is loaded.
+     *
+     * <p>The cache is stored in the {@code bytecodecache} subdirectory
+     * of the {@linkplain #userDataDirectoryProperty user data directory},
+     * and has no effect if no user data directory could be applied.
+     * Cached bytecode is only reused for a script whose URL and contents
+     * are unchanged and that was compiled by the same version of the
+     * JavaScript engine.
+     *
+     * @defaultValue false
+     * @since 28
+     */
+    private BooleanProperty bytecodeCacheEnabled;
+
+    public final void setBytecodeCacheEnabled(boolean value) {
+        bytecodeCacheEnabledProperty().set(value);
+    }
+
+    public final boolean isBytecodeCacheEnabled() {
+        return bytecodeCacheEnabled == null ? false : bytecodeCacheEnabled.get();
+    }
+
+    public final BooleanProperty bytecodeCacheEnabledProperty() {
+        if (bytecodeCacheEnabled == null) {
+            bytecodeCacheEnabled = new BooleanPropertyBase(false) {
+                @Override public void invalidated() {
+                    checkThread();
+                    applyBytecodeCacheDirectory();
+                }
+
+                @Override public Object getBean() {
+                    return WebEngine.this;
+                }
+
+                @Override public String getName() {
+                    return "bytecodeCacheEnabled";
+                }
+            };
+        }
+        return bytecodeCacheEnabled;
+    }
+
     /**
      * Location of the user stylesheet as a string URL.
      *
@@ -627,8 +677,11 @@ final public class WebEngine {
      * data.
      *
      * <p>Currently, the directory specified by this property is used
-     * only to store the data that backs the {@code window.localStorage}
-     * objects. In the future, more types of data can be added.
+     * to store the data that backs the {@code window.localStorage}
+     * objects, the IndexedDB databases and, if
+     * {@link #bytecodeCacheEnabledProperty bytecodeCacheEnabled}
+     * is set, the compiled bytecode of external scripts. In the future,
+     * more types of data can be added.
      *
      * @defaultValue {@code null}
      * @since JavaFX 8.0
@@ -1000,6 +1053,12 @@ final public class WebEngine {
         page.stop(page.getMainFrame());
     }
 
+    private void applyBytecodeCacheDirectory() {
+        page.setBytecodeCacheDirectory(
+                isBytecodeCacheEnabled() && bytecodeCacheDir != null
+                        ? bytecodeCacheDir.getPath() : null);
+    }
+
     private void applyUserDataDirectory() {
         if (userDataDirectoryApplied) {
             return;
@@ -1023,9 +1082,12 @@ final public class WebEngine {
             try {
                 userDataDir = DirectoryLock.canonicalize(userDataDir);
                 File localStorageDir = new File(userDataDir, "localstorage");
+                File indexedDBDir = new File(userDataDir, "indexeddb");
+                File bytecodeCacheDir = new File(userDataDir, "bytecodecache");
                 File[] dirs = new File[] {
                     userDataDir,
                     localStorageDir,
+                    indexedDBDir,
                 };
                 for (File dir : dirs) {
                     createDirectories(dir);
@@ -1040,6 +1102,10 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                page.setIndexedDatabaseDirectory(indexedDBDir.getPath());
+
+                this.bytecodeCacheDir = bytecodeCacheDir;
+                applyBytecodeCacheDirectory();
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
@@ -338,7 +338,7 @@ MappedFileData createMappedFileData(const String& path, size_t bytesSize, FileHa
         return { };
     }
 
-#if HAVE(FALLOCATE) && !PLATFORM(JAVA)
+#if HAVE(FALLOCATE) && (!PLATFORM(JAVA) || OS(LINUX))
     // Reserve real blocks so a later mmap'd memcpy() can't SIGBUS on ENOSPC.
     // EOPNOTSUPP: filesystem doesn't support pre-allocation -> preserve old behavior.
     // posix_fallocate is avoided because it falls back to zero-filling when pre-allocation
@@ -92,6 +92,7 @@ elseif (UNIX)
         generic/WorkQueueGeneric.cpp
         linux/CurrentProcessMemoryStatus.cpp
         linux/MemoryFootprintLinux.cpp
+        posix/FileHandlePOSIX.cpp
         unix/LanguageUnix.cpp
         unix/MemoryPressureHandlerUnix.cpp
         linux/RealTimeThreads.cpp
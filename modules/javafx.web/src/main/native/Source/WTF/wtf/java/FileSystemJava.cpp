@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,18 +41,30 @@
     #include <unistd.h>
 #endif
 
+#if OS(LINUX)
+    #include <dirent.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <fnmatch.h>
+    #include <stdlib.h>
+    #include <string.h>
+#endif
+
 namespace WTF {
 
 namespace FileSystemImpl {
 
+#if !OS(LINUX)
 static inline bool isHandleValid(PlatformFileHandle handle)
 {
     return handle != invalidPlatformFileHandle;
 }
+#endif
 
 #if HAVE(MMAP)
 MappedFileData::MappedFileData(MmapSpan<uint8_t>&& fileData)
     : m_fileData(WTF::move(fileData))
+    , m_isValid(true)
 { }
 
 MappedFileData::~MappedFileData() = default;
@@ -70,9 +82,229 @@ MappedFileData::~MappedFileData()
 }
 #endif
 
+#if OS(LINUX)
+// -----------------------------------------------------------------------
+//  On Linux, files are opened, read, written and mapped with POSIX calls,
+//  see also posix/FileHandlePOSIX.cpp. The JNI round trip of the Java
+//  implementation below dominated small reads, and a RandomAccessFile
+//  can not be mapped into memory.
+// -----------------------------------------------------------------------
+bool fileExists(const String& path)
+{
+    struct stat fileInfo;
+    return !stat(path.utf8().data(), &fileInfo);
+}
+
+bool getFileSize(const String& path, long long& result)
+{
+    struct stat fileInfo;
+    if (stat(path.utf8().data(), &fileInfo))
+        return false;
+
+    result = fileInfo.st_size;
+    return true;
+}
+
+FileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission permission, OptionSet<FileLockMode> lockMode, bool failIfFileExists)
+{
+    CString fsRep = path.utf8();
+    if (fsRep.isNull())
+        return { };
+
+    int platformFlag = O_CLOEXEC;
+    switch (mode) {
+    case FileOpenMode::Read:
+        platformFlag |= O_RDONLY;
+        break;
+    case FileOpenMode::Truncate:
+        platformFlag |= (O_WRONLY | O_CREAT | O_TRUNC);
+        break;
+    case FileOpenMode::ReadWrite:
+        platformFlag |= (O_RDWR | O_CREAT);
+        break;
+    }
+
+    if (failIfFileExists)
+        platformFlag |= (O_CREAT | O_EXCL);
+
+    int permissionFlag = 0;
+    if (permission == FileAccessPermission::User)
+        permissionFlag |= (S_IRUSR | S_IWUSR);
+    else if (permission == FileAccessPermission::All)
+        permissionFlag |= (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+
+    return FileHandle::adopt(open(fsRep.data(), platformFlag, permissionFlag), lockMode);
+}
+
+std::optional<Vector<uint8_t>> readEntireFile(const String& path)
+{
+    auto handle = openFile(path, FileOpenMode::Read);
+    return handle.readAll();
+}
+
+std::optional<uint64_t> overwriteEntireFile(const String& path, std::span<const uint8_t> span)
+{
+    auto handle = openFile(path, FileOpenMode::Truncate);
+    if (!handle)
+        return { };
+
+    return handle.write(span);
+}
+
+bool deleteFile(const String& path)
+{
+    return !unlink(path.utf8().data());
+}
+
+bool deleteEmptyDirectory(const String& path)
+{
+    return !rmdir(path.utf8().data());
+}
+
+bool moveFile(const String& oldPath, const String& newPath)
+{
+    // Callers only move within a directory, so rename() is sufficient.
+    return !rename(oldPath.utf8().data(), newPath.utf8().data());
+}
+
+String parentPath(const String& path)
+{
+    size_t separator = path.reverseFind('/');
+    if (separator == notFound)
+        return emptyString();
+    if (!separator)
+        return "/"_s;
+    return path.left(separator);
+}
+
+Vector<String> listDirectory(const String& path)
+{
+    Vector<String> fileNames;
+    DIR* directory = opendir(path.utf8().data());
+    if (!directory)
+        return fileNames;
+
+    while (struct dirent* entry = readdir(directory)) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+            continue;
+        fileNames.append(String::fromUTF8(entry->d_name));
+    }
+    closedir(directory);
+    return fileNames;
+}
+
+Vector<String> listDirectory(const String& path, const String& filter)
+{
+    CString pattern = filter.utf8();
+    Vector<String> fileNames;
+    for (auto& fileName : listDirectory(path)) {
+        if (!fnmatch(pattern.data(), fileName.utf8().data(), 0))
+            fileNames.append(fileName);
+    }
+    return fileNames;
+}
+
+std::pair<String, FileHandle> openTemporaryFile(StringView prefix, StringView suffix, const String& temporaryDirectory)
+{
+    CString directory = temporaryDirectory.utf8();
+    const char* directoryPath = directory.data();
+    if (temporaryDirectory.isEmpty()) {
+        directoryPath = getenv("TMPDIR");
+        if (!directoryPath)
+            directoryPath = "/tmp";
+    }
+
+    CString path = makeString(String::fromUTF8(directoryPath), '/', prefix, "-XXXXXX"_s, suffix).utf8();
+    Vector<char> buffer(path.length() + 1);
+    memcpy(buffer.mutableSpan().data(), path.data(), path.length() + 1);
+
+    auto handle = FileHandle::adopt(mkostemps(buffer.mutableSpan().data(), suffix.utf8().length(), O_CLOEXEC));
+    if (!handle)
+        return { String(), FileHandle() };
+
+    return { String::fromUTF8(buffer.span().data()), WTF::move(handle) };
+}
+
+int writeToFile(PlatformFileHandle handle, const void* data, int length)
+{
+    if (handle == invalidPlatformFileHandle || length < 0)
+        return -1;
+
+    int written = 0;
+    while (written < length) {
+        ssize_t result = write(handle, static_cast<const char*>(data) + written, length - written);
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        written += result;
+    }
+    return written;
+}
+
+bool truncateFile(PlatformFileHandle handle, long long offset)
+{
+    return handle != invalidPlatformFileHandle && !ftruncate(handle, offset);
+}
+
+bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
+{
+    if (!link(targetPath.utf8().data(), linkPath.utf8().data()))
+        return true;
+
+    // IndexedDB moves its blob files out of the temporary directory this
+    // way, which may be on another file system.
+    auto data = readEntireFile(targetPath);
+    if (!data)
+        return false;
+
+    auto handle = openFile(linkPath, FileOpenMode::Truncate, FileAccessPermission::User, { }, true);
+    return handle && handle.write(data->span()) == data->size();
+}
+
+static FileType fileTypeOf(const struct stat& fileInfo)
+{
+    if (S_ISDIR(fileInfo.st_mode))
+        return FileType::Directory;
+    if (S_ISLNK(fileInfo.st_mode))
+        return FileType::SymbolicLink;
+    return FileType::Regular;
+}
+
+std::optional<FileType> fileType(const String& path)
+{
+    struct stat fileInfo;
+    if (lstat(path.utf8().data(), &fileInfo))
+        return std::nullopt;
+    return fileTypeOf(fileInfo);
+}
+
+std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
+{
+    struct stat fileInfo;
+    if (stat(path.utf8().data(), &fileInfo))
+        return std::nullopt;
+    return fileTypeOf(fileInfo);
+}
+
+bool deleteNonEmptyDirectory(const String& path)
+{
+    for (auto& fileName : listDirectory(path)) {
+        auto childPath = makeString(path, '/', fileName);
+        if (fileType(childPath) == FileType::Directory)
+            deleteNonEmptyDirectory(childPath);
+        else
+            deleteFile(childPath);
+    }
+    return deleteEmptyDirectory(path);
+}
+#endif // OS(LINUX)
+
 // -----------------------------------------------------------------------
 //  Below methods use Java calls to implement the intended functionality.
 // -----------------------------------------------------------------------
+#if !OS(LINUX)
 bool fileExists(const String& path)
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -116,11 +348,13 @@ bool getFileSize(const String& path, long long& result)
         return false;
     }
 }
+#endif // !OS(LINUX)
 
 std::optional<uint64_t> fileSize(const String& path)
 {
     long long size = 0;
-    getFileSize(path, size);
+    if (!getFileSize(path, size))
+        return std::nullopt;
     return size;
 }
 
@@ -244,6 +478,7 @@ CString fileSystemRepresentation(const String& s)
     return CString(s.latin1().data());
 }
 
+#if !OS(LINUX)
 FileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, OptionSet<FileLockMode> , bool failIfFileExists)
 {
     if (mode != FileOpenMode::Read) {
@@ -358,6 +593,7 @@ std::optional<uint64_t> FileHandle::size()
 {
    return {};
 }
+#endif // !OS(LINUX)
 
 
 String pathFileName(const String& path)
@@ -379,6 +615,7 @@ String pathFileName(const String& path)
     return String(env, result);
 }
 
+#if !OS(LINUX)
 long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
 {
     // we always get positive value for offset from webkit.
@@ -412,6 +649,7 @@ std::optional<uint64_t> FileHandle::seek(int64_t offset, FileSeekOrigin origin)
 
     return static_cast<uint64_t>(pos);
 }
+#endif // !OS(LINUX)
 
 // -----------------------------------------------------------------------
 // Below methods are stubs as of now.
@@ -436,6 +674,7 @@ String directoryName(String const &)
     return String();
 }
 
+#if !OS(LINUX)
 Vector<String> listDirectory(const String&, const String&)
 {
     fprintf(stderr, "listDirectory(const String&, const String&) NOT IMPLEMENTED\n");
@@ -467,6 +706,7 @@ bool truncateFile(PlatformFileHandle, long long offset)
     UNUSED_PARAM(offset);
     return false;
 }
+#endif // !OS(LINUX)
 
 std::optional<int32_t> getFileDeviceId(const String&)
 {
@@ -482,6 +722,7 @@ bool unmapViewOfFile(void* , size_t)
 }
 
 
+#if !OS(LINUX)
 bool deleteFile(const String&)
 {
     fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
@@ -518,6 +759,7 @@ bool moveFile(const String& oldPath, const String& newPath)
 
     return false;
 }
+#endif // !OS(LINUX)
 
 bool isHiddenFile(const String& path)
 {
@@ -526,6 +768,7 @@ bool isHiddenFile(const String& path)
     return false;
 }
 
+#if !OS(LINUX)
 bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
 {
     fprintf(stderr, "hardLinkOrCopyFile(const String& targetPath, const String& linkPath) NOT IMPLEMENTED\n");
@@ -548,6 +791,7 @@ std::optional<FileType> fileType(const String& path)
     UNUSED_PARAM(path);
     return {};
 }
+#endif // !OS(LINUX)
 
 void deleteAllFilesModifiedSince(const String& path, WallTime t)
 {
@@ -570,6 +814,7 @@ std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
     Vector<uint8_t> vec;
     return vec;
 }
+#if !OS(LINUX)
 std::optional<Vector<uint8_t>> readEntireFile(const String& path)
 {
     fprintf(stderr, "readEntireFile(const String& path) NOT IMPLEMENTED\n");
@@ -583,6 +828,7 @@ bool deleteNonEmptyDirectory(String const &)
     fprintf(stderr, "deleteNonEmptyDirectory(String const &) NOT IMPLEMENTED\n");
     return false;
 }
+#endif
 
 std::optional<uint64_t> fileSize(PlatformFileHandle handle)
 {
@@ -606,17 +852,26 @@ bool fileIDsAreEqual(std::optional<PlatformFileID> a, std::optional<PlatformFile
     return true;
 }
 
+#if !OS(LINUX)
 std::optional<uint64_t> overwriteEntireFile(const String& path, std::span<const uint8_t>)
 {
     fprintf(stderr, "overwriteEntireFile(const String& path, std::span<const uint8_t>) NOT IMPLEMENTED\n");
     return {};
 }
+#endif
 
+#if OS(LINUX)
+int64_t writeToFile(PlatformFileHandle handle, std::span<const uint8_t> data)
+{
+    return writeToFile(handle, data.data(), static_cast<int>(data.size()));
+}
+#else
 int64_t writeToFile(PlatformFileHandle, std::span<const uint8_t> data)
 {
      fprintf(stderr, "writeToFile(PlatformFileHandle, std::span<const uint8_t> data) NOT IMPLEMENTED\n");
      return 0;
 }
+#endif
 
 int64_t readFromFile(PlatformFileHandle, std::span<uint8_t> data)
 {
@@ -102,7 +102,9 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     platform/graphics/texmap/BitmapTextureJava.h
     platform/graphics/texmap/TextureMapperJava.h
     platform/graphics/texmap/TextureMapperJavaAdapter.h
+    platform/java/BytecodeCacheJava.h
     platform/java/DataObjectJava.h
+    platform/java/MemoryPressureMonitorJava.h
     platform/java/PageSupplementJava.h
     platform/java/PlatformJavaClasses.h
     platform/java/PluginWidgetJava.h
@@ -31,6 +31,10 @@
 #include "CachedScriptFetcher.h"
 #include <JavaScriptCore/SourceProvider.h>
 
+#if PLATFORM(JAVA)
+#include "BytecodeCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class CachedScriptSourceProvider final : public JSC::SourceProvider, public CachedResourceClient {
@@ -40,6 +44,9 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(JAVA)
+        commitCachedBytecode();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
@@ -55,6 +62,47 @@ public:
         return m_cachedScript->codeBlockHashConcurrently(startOffset, endOffset, kind, isModuleType() ? CachedScript::ShouldDecodeAsUTF8Only::Yes : CachedScript::ShouldDecodeAsUTF8Only::No);
     }
 
+#if PLATFORM(JAVA)
+    void setBytecodeCache(RefPtr<BytecodeCacheJava>&& bytecodeCache)
+    {
+        if (!isModuleType())
+            m_bytecodeCache = WTF::move(bytecodeCache);
+    }
+
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final
+    {
+        if (m_bytecodeCache && !m_didLoadCachedBytecode) {
+            m_didLoadCachedBytecode = true;
+            m_cachedBytecode = m_bytecodeCache->load(sourceOrigin().url(), hash());
+        }
+        return m_cachedBytecode.copyRef();
+    }
+
+    void cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const final
+    {
+        if (!m_bytecodeCache)
+            return;
+        if (!m_cachedBytecode)
+            m_cachedBytecode = JSC::CachedBytecode::create();
+        if (auto update = generator())
+            m_cachedBytecode->addGlobalUpdate(update.releaseNonNull());
+    }
+
+    void updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const final
+    {
+        if (m_bytecodeCache && m_cachedBytecode)
+            m_bytecodeCache->addFunctionUpdate(*m_cachedBytecode, executable, kind, codeBlock);
+    }
+
+    void commitCachedBytecode() const final
+    {
+        if (!m_bytecodeCache || !m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+            return;
+        m_bytecodeCache->store(sourceOrigin().url(), hash(), *m_cachedBytecode);
+        m_cachedBytecode = nullptr;
+    }
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTF::move(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), cachedScript->requiresPrivacyProtections() ? JSC::SourceTaintedOrigin::KnownTainted : JSC::SourceTaintedOrigin::Untainted, TextPosition(), sourceType)
@@ -64,6 +112,11 @@ private:
     }
 
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    RefPtr<BytecodeCacheJava> m_bytecodeCache;
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    mutable bool m_didLoadCachedBytecode { false };
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
@@ -90,6 +90,10 @@
 #include <wtf/text/MakeString.h>
 #include <wtf/text/TextPosition.h>
 
+#if PLATFORM(JAVA)
+#include "PageSupplementJava.h"
+#endif
+
 #define SCRIPTCONTROLLER_RELEASE_LOG_ERROR(channel, fmt, ...) RELEASE_LOG_ERROR(channel, "%p - ScriptController::" fmt, this, ##__VA_ARGS__)
 
 #if ENABLE(LLVM_PROFILE_GENERATION)
@@ -170,6 +174,17 @@ ValueOrException ScriptController::evaluateInWorld(const ScriptSourceCode& sourc
             evaluateIgnoringException({ WTF::move(script), JSC::SourceTaintedOrigin::Untainted });
     }
 
+#if PLATFORM(JAVA)
+    if (sourceCode.cachedScript() && m_frame->page()) {
+        auto* pageSupplement = PageSupplementJava::from(m_frame->page());
+        if (pageSupplement && pageSupplement->bytecodeCache()) {
+            Ref provider = *static_cast<CachedScriptSourceProvider*>(jsSourceCode.provider());
+            provider->setBytecodeCache(pageSupplement->bytecodeCache());
+            pageSupplement->addBytecodeCacheClient(m_frame->frameID(), WTF::move(provider));
+        }
+    }
+#endif
+
     InspectorInstrumentation::willEvaluateScript(protectedFrame(), sourceURL.string(), sourceCode.startLine(), sourceCode.startColumn());
 
     NakedPtr<JSC::Exception> evaluationException;
@@ -609,6 +624,13 @@ void ScriptController::clearScriptObjects()
         Ref { *m_bindingRootObject }->invalidate();
         m_bindingRootObject = nullptr;
     }
+
+#if PLATFORM(JAVA)
+    if (RefPtr page = m_frame->page()) {
+        if (auto* pageSupplement = PageSupplementJava::from(page.get()))
+            pageSupplement->commitCachedBytecode(m_frame->frameID());
+    }
+#endif
 }
 
 JSC::JSValue ScriptController::executeScriptIgnoringException(const String& script, JSC::SourceTaintedOrigin taintedness, bool forceUserGesture)
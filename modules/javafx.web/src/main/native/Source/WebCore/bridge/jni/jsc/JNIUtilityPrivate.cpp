@@ -154,7 +154,7 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                 } else if (value.isString() && !strcmp(javaClassName, "java.lang.Character")) {
                     JNIEnv* env = getJNIEnv();
                     static JGClass clazz(env->FindClass("java/lang/Character"));
-                    jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(C)Ljava/lang/Character;");
+                    static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(C)Ljava/lang/Character;");
                     jchar charValue = toJCharValue(value, globalObject);
                     jobject javaChar = env->CallStaticObjectMethod(clazz, meth, charValue);
                     result.l = javaChar;
@@ -162,12 +162,12 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                     JNIEnv* env = getJNIEnv();
                     if (value.isInt32() && (!strcmp(javaClassName, "java.lang.Number") || !strcmp(javaClassName, "java.lang.Integer") || !strcmp(javaClassName, "java.lang.Object"))) {
                         static JGClass clazz(env->FindClass("java/lang/Integer"));
-                        jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(I)Ljava/lang/Integer;");
+                        static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(I)Ljava/lang/Integer;");
                         result.l = env->CallStaticObjectMethod(clazz, meth, (jint) value.asInt32());
                     } else if (!strcmp(javaClassName, "java.lang.Number") || !strcmp(javaClassName, "java.lang.Double") || !strcmp(javaClassName, "java.lang.Object")) {
                         jdouble doubleValue = (jdouble) value.asNumber();
                         static JGClass clazz = env->FindClass("java/lang/Double");
-                        jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(D)Ljava/lang/Double;");
+                        static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(D)Ljava/lang/Double;");
                         jobject javaDouble = env->CallStaticObjectMethod(clazz, meth, doubleValue);
                         result.l = javaDouble;
                     }
@@ -175,7 +175,7 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                     bool boolValue = value.asBoolean();
                     JNIEnv* env = getJNIEnv();
                     static JGClass clazz(env->FindClass("java/lang/Boolean"));
-                    jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(Z)Ljava/lang/Boolean;");
+                    static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(Z)Ljava/lang/Boolean;");
                     jobject javaBoolean = env->CallStaticObjectMethod(clazz, meth, boolValue);
                     result.l = javaBoolean;
                 } else if (value.isUndefined()) {
@@ -253,58 +253,56 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
 
 jobject jvalueToJObject(jvalue value, JavaType jtype) {
     JNIEnv* env = getJNIEnv();
-    jmethodID meth;
     switch (jtype) {
     case JavaTypeObject:
     case JavaTypeArray:
         return value.l;
     case JavaTypeBoolean: {
       static JGClass clsZ(env->FindClass("java/lang/Boolean"));
-      meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
-      return env->CallStaticObjectMethod(clsZ, meth, value.z);
+      static jmethodID methZ = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
+      return env->CallStaticObjectMethod(clsZ, methZ, value.z);
     }
     case JavaTypeChar: {
       static JGClass clsC(env->FindClass("java/lang/Character"));
-      meth = env->GetStaticMethodID(clsC, "valueOf",
-                                    "(C)Ljava/lang/Character;");
-      return env->CallStaticObjectMethod(clsC, meth, value.c);
+      static jmethodID methC = env->GetStaticMethodID(clsC, "valueOf", "(C)Ljava/lang/Character;");
+      return env->CallStaticObjectMethod(clsC, methC, value.c);
     }
     case JavaTypeByte: {
       static JGClass clsB(env->FindClass("java/lang/Byte"));
-      meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
-      return env->CallStaticObjectMethod(clsB, meth, value.b);
+      static jmethodID methB = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
+      return env->CallStaticObjectMethod(clsB, methB, value.b);
     }
     case JavaTypeShort: {
       static JGClass clsS(env->FindClass("java/lang/Short"));
-      meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
-      return env->CallStaticObjectMethod(clsS, meth, value.s);
+      static jmethodID methS = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
+      return env->CallStaticObjectMethod(clsS, methS, value.s);
     }
     case JavaTypeInt: {
       static JGClass clsI(env->FindClass("java/lang/Integer"));
-      meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
-      return env->CallStaticObjectMethod(clsI, meth, value.i);
+      static jmethodID methI = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
+      return env->CallStaticObjectMethod(clsI, methI, value.i);
     }
     case JavaTypeLong: {
       static JGClass clsJ(env->FindClass("java/lang/Long"));
-      meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
-      return env->CallStaticObjectMethod(clsJ, meth, value.j);
+      static jmethodID methJ = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
+      return env->CallStaticObjectMethod(clsJ, methJ, value.j);
     }
     case JavaTypeFloat: {
       static JGClass clsF(env->FindClass("java/lang/Float"));
-      meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
-      return env->CallStaticObjectMethod(clsF, meth, value.f);
+      static jmethodID methF = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
+      return env->CallStaticObjectMethod(clsF, methF, value.f);
     }
     case JavaTypeDouble: {
       static JGClass clsD(env->FindClass("java/lang/Double"));
-      meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
-      return env->CallStaticObjectMethod(clsD, meth, value.d);
+      static jmethodID methD = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
+      return env->CallStaticObjectMethod(clsD, methD, value.d);
     }
     default:
         abort();
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+jthrowable dispatchJNICall(int count, RootObject* rootObject, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -315,23 +313,46 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, rootObject, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
+        env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
+                               "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+    ASSERT(invokeMethod);
+
     jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
     for (int i = 0;  i < count; i++)
       env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
-        env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
-                               "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, argsArray,
                                             accessControlContext);
+    env->DeleteLocalRef(argsArray);
 
     jthrowable ex = env->ExceptionOccurred();
     env->ExceptionClear();
 
+    // Primitive results come boxed. Byte to Double all extend
+    // java.lang.Number, so a single set of method IDs unboxes them.
+    static JGClass numberCls(env->FindClass("java/lang/Number"));
+    static JGClass booleanCls(env->FindClass("java/lang/Boolean"));
+
+    result.j = 0;
     switch (returnType) {
     case JavaTypeVoid:
         {
@@ -346,31 +367,59 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
         break;
 
     case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
+        {
+            static jmethodID mid = env->GetMethodID(booleanCls, "booleanValue", "()Z");
+            if (r)
+                result.z = env->CallBooleanMethod(r, mid);
+        }
         break;
 
     case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
+        {
+            static jmethodID mid = env->GetMethodID(numberCls, "byteValue", "()B");
+            if (r)
+                result.b = env->CallByteMethod(r, mid);
+        }
         break;
 
     case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
+        {
+            static jmethodID mid = env->GetMethodID(numberCls, "shortValue", "()S");
+            if (r)
+                result.s = env->CallShortMethod(r, mid);
+        }
         break;
 
     case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
+        {
+            static jmethodID mid = env->GetMethodID(numberCls, "intValue", "()I");
+            if (r)
+                result.i = env->CallIntMethod(r, mid);
+        }
         break;
 
     case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
+        {
+            static jmethodID mid = env->GetMethodID(numberCls, "longValue", "()J");
+            if (r)
+                result.j = env->CallLongMethod(r, mid);
+        }
         break;
 
     case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
+        {
+            static jmethodID mid = env->GetMethodID(numberCls, "floatValue", "()F");
+            if (r)
+                result.f = env->CallFloatMethod(r, mid);
+        }
         break;
 
     case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
+        {
+            static jmethodID mid = env->GetMethodID(numberCls, "doubleValue", "()D");
+            if (r)
+                result.d = env->CallDoubleMethod(r, mid);
+        }
         break;
 
     case JavaTypeInvalid:
@@ -32,12 +32,129 @@
 #include "JavaFieldJSC.h"
 #include "JavaMethodJSC.h"
 #include "JNIUtilityPrivate.h"
+#include "runtime_root.h"
 #include <JavaScriptCore/Identifier.h>
 #include <JavaScriptCore/JSLock.h>
+#include <wtf/HashSet.h>
+#include <wtf/NeverDestroyed.h>
 
 using namespace JSC;
 using namespace JSC::Bindings;
 
+namespace {
+
+// The JavaClass of every Java class with instances bound to JavaScript,
+// keyed by the identity hash code of the class. A JavaClass only holds the
+// public fields and methods of its class, so all instances and pages share
+// it. The class itself is only referenced weakly; an entry is dropped when
+// its class is unloaded or the last root object it was requested for is
+// invalidated, whichever comes first.
+class JavaClassCache final : public RootObject::InvalidationCallback {
+public:
+    static JavaClassCache& singleton()
+    {
+        static NeverDestroyed<JavaClassCache> cache;
+        return cache;
+    }
+
+    RefPtr<JavaClass> find(JNIEnv* env, jclass javaClass, jint hash, RootObject* rootObject)
+    {
+        auto it = m_entries.find(hash);
+        if (it == m_entries.end())
+            return nullptr;
+        for (auto& entry : it->value) {
+            if (env->IsSameObject(entry.javaClass, javaClass)) {
+                addRootObject(entry, rootObject);
+                return entry.wrapper;
+            }
+        }
+        return nullptr;
+    }
+
+    void add(JNIEnv* env, jclass javaClass, jint hash, RootObject* rootObject, JavaClass& wrapper)
+    {
+        removeUnloadedClasses(env);
+        Entry entry { env->NewWeakGlobalRef(javaClass), &wrapper, { } };
+        addRootObject(entry, rootObject);
+        m_entries.add(hash, Vector<Entry>()).iterator->value.append(WTF::move(entry));
+    }
+
+    void operator()(RootObject* rootObject) final
+    {
+        JNIEnv* env = getJNIEnv();
+        m_entries.removeIf([&](auto& bucket) {
+            bucket.value.removeAllMatching([&](auto& entry) {
+                entry.rootObjects.remove(rootObject);
+                return removeIfUnused(env, entry);
+            });
+            return bucket.value.isEmpty();
+        });
+    }
+
+private:
+    struct Entry {
+        jweak javaClass;
+        RefPtr<JavaClass> wrapper;
+        HashSet<RootObject*> rootObjects;
+    };
+
+    void addRootObject(Entry& entry, RootObject* rootObject)
+    {
+        // Invalidation callbacks are kept in a set, so a root object calls
+        // back once however many classes it requested.
+        if (entry.rootObjects.add(rootObject).isNewEntry)
+            rootObject->addInvalidationCallback(this);
+    }
+
+    static bool removeIfUnused(JNIEnv* env, Entry& entry)
+    {
+        if (!entry.rootObjects.isEmpty() && !env->IsSameObject(entry.javaClass, nullptr))
+            return false;
+        env->DeleteWeakGlobalRef(entry.javaClass);
+        return true;
+    }
+
+    void removeUnloadedClasses(JNIEnv* env)
+    {
+        m_entries.removeIf([&](auto& bucket) {
+            bucket.value.removeAllMatching([&](auto& entry) {
+                return removeIfUnused(env, entry);
+            });
+            return bucket.value.isEmpty();
+        });
+    }
+
+    HashMap<jint, Vector<Entry>, IntHash<jint>, WTF::SignedWithZeroKeyHashTraits<jint>> m_entries;
+};
+
+} // namespace
+
+Ref<JavaClass> JavaClass::classForInstance(jobject anInstance, RootObject* rootObject, jobject accessControlContext)
+{
+    // Since anInstance is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(anInstance, true);
+    if (!jlinstance || !rootObject || !rootObject->isValid())
+        return adoptRef(*new JavaClass(anInstance, rootObject, accessControlContext));
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass systemClass(env->FindClass("java/lang/System"));
+    static jmethodID identityHashCodeID = env->GetStaticMethodID(systemClass, "identityHashCode", "(Ljava/lang/Object;)I");
+    ASSERT(identityHashCodeID);
+
+    JLClass javaClass(env->GetObjectClass(jlinstance));
+    jint hash = env->CallStaticIntMethod(systemClass, identityHashCodeID, (jobject)javaClass);
+    if (WTF::CheckAndClearException(env))
+        return adoptRef(*new JavaClass(anInstance, rootObject, accessControlContext));
+
+    auto& cache = JavaClassCache::singleton();
+    if (auto wrapper = cache.find(env, javaClass, hash, rootObject))
+        return wrapper.releaseNonNull();
+
+    Ref wrapper = adoptRef(*new JavaClass(anInstance, rootObject, accessControlContext));
+    cache.add(env, javaClass, hash, rootObject, wrapper);
+    return wrapper;
+}
+
 JavaClass::JavaClass(jobject anInstance, RootObject* rootObject, jobject accessControlContext)
 {
     // Since anInstance is WeakGlobalRef, creating a localref to safeguard instance() from GC
@@ -170,6 +287,9 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
     size_t i;
     if (nameLength >= 3 && name[nameLength-1] == ')'
         && (i = name.find('(', 1)) != WTF::notFound) {
+        auto cached = m_methodsBySignature.find(name);
+        if (cached != m_methodsBySignature.end())
+            return cached->value;
         Vector<String> pnames;
         size_t pstart = i + 1;
         if (pstart < nameLength-1) {
@@ -258,6 +378,10 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
                 }
             }
         }
+        Method* method = methodList ? methodList->at(0) : nullptr;
+        delete methodList;
+        m_methodsBySignature.add(name, method);
+        return method;
     } else {
         methodList = m_methods.get(name.impl());
     }
@@ -30,14 +30,18 @@
 #include "BridgeJSC.h"
 #include "JNIUtility.h"
 #include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
 
 namespace JSC {
 
 namespace Bindings {
 
-class JavaClass : public Class {
+class JavaClass : public Class, public RefCounted<JavaClass> {
 public:
-    JavaClass(jobject, RootObject*, jobject accessControlContext);
+    // Returns the JavaClass for the class of the instance. It is shared by
+    // all instances of that class until the last root object it was
+    // requested for is invalidated.
+    static Ref<JavaClass> classForInstance(jobject, RootObject*, jobject accessControlContext);
     ~JavaClass();
 
     virtual Method* methodNamed(PropertyName, Instance*) const;
@@ -57,10 +61,14 @@ private:
     struct wpe_renderer_backend_egl* m_backend { nullptr };
 #endif
 #if PLATFORM(JAVA)
+    JavaClass(jobject, RootObject*, jobject accessControlContext);
+
     jobject createDummyObject();
     const char* m_name;
         mutable FieldMap m_fields;
         mutable MethodListMap m_methods;
+        // Methods looked up with an explicit signature, e.g. "f(int,String)".
+        mutable HashMap<String, Method*> m_methodsBySignature;
 #endif
 };
 
@@ -56,14 +56,10 @@ JavaInstance::JavaInstance(jobject instance, RefPtr<RootObject>&& rootObject, jo
     : Instance(WTF::move(rootObject))
 {
     m_instance = JobjectWrapper::create(instance);
-    m_class = 0;
     m_accessControlContext = JobjectWrapper::create(accessControlContext, true);
 }
 
-JavaInstance::~JavaInstance()
-{
-    delete m_class;
-}
+JavaInstance::~JavaInstance() = default;
 
 RuntimeObject* JavaInstance::newRuntimeObject(JSGlobalObject* globalObject)
 {
@@ -86,9 +82,9 @@ Class* JavaInstance::getClass() const
 {
     if (!m_class) {
         jobject acc = accessControlContext();
-        m_class = new JavaClass(m_instance->instance(), rootObject(), acc);
+        m_class = JavaClass::classForInstance(m_instance->instance(), rootObject(), acc);
     }
-    return m_class;
+    return m_class.get();
 }
 
 JSValue JavaInstance::stringValue(JSGlobalObject* globalObject) const
@@ -310,11 +306,7 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
     Vector<jobject> jArgs(count);
 
     for (int i = 0; i < count; i++) {
-        CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
-        jvalue jarg = convertValueToJValue(globalObject, m_rootObject.get(),
-            callFrame->argument(i), jtype, javaClassName.data());
-        jArgs[i] = jvalueToJObject(jarg, jtype);
+        jArgs[i] = jMethod->convertArgument(i, globalObject, m_rootObject.get(), callFrame->argument(i));
 #if !PLATFORM(JAVA)
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, callFrame->argument(i).toString(globalObject)->value(globalObject).ascii().data());
 #endif
@@ -343,11 +335,13 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
+        jobject reflectedMethod = jMethod->reflectedMethod(obj);
+        if (!reflectedMethod)
+            return jsUndefined();
 
         jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
+                                        obj, reflectedMethod,
+                                        jMethod->returnType(),
                                         jArgs.mutableSpan().data(), result,
                                         accessControlContext());
         if (ex != NULL) {
@@ -29,7 +29,9 @@
 
 #if ENABLE(JAVA_BRIDGE)
 
+#include "JNIUtilityPrivate.h"
 #include <JavaScriptCore/JSObject.h>
+#include <JavaScriptCore/JSString.h>
 #include <wtf/text/StringBuilder.h>
 
 using namespace JSC;
@@ -111,14 +113,14 @@ const char* JavaMethod::signature() const
         StringBuilder signatureBuilder;
         signatureBuilder.append('(');
         for (unsigned int i = 0; i < m_parameters.size(); i++) {
-            CString javaClassName = parameterAt(i).utf8();
-            JavaType type = javaTypeFromClassName(javaClassName.data());
+            const char* javaClassName = parameterClassNameAt(i);
+            JavaType type = parameterTypeAt(i);
             if (type == JavaTypeArray)
-                appendClassName(signatureBuilder, javaClassName.data());
+                appendClassName(signatureBuilder, javaClassName);
             else {
                 signatureBuilder.append(ASCIILiteral::fromLiteralUnsafe(signatureFromJavaType(type)));
                 if (type == JavaTypeObject) {
-                    appendClassName(signatureBuilder, javaClassName.data());
+                    appendClassName(signatureBuilder, javaClassName);
                     signatureBuilder.append(';');
                 }
             }
@@ -143,4 +145,92 @@ const char* JavaMethod::signature() const
     return m_signature;
 }
 
+void JavaMethod::ensureParameterTypes() const
+{
+    if (m_parameterTypes.size() == m_parameters.size())
+        return;
+
+    m_parameterClassNames.clear();
+    m_parameterTypes.clear();
+    m_argumentConversions.clear();
+    for (auto& parameter : m_parameters) {
+        CString javaClassName = parameter.utf8();
+        JavaType type = javaTypeFromClassName(javaClassName.data());
+        ArgumentConversion conversion = ArgumentConversion::Generic;
+        if (type == JavaTypeInt)
+            conversion = ArgumentConversion::Int;
+        else if (type == JavaTypeDouble)
+            conversion = ArgumentConversion::Double;
+        else if (type == JavaTypeBoolean)
+            conversion = ArgumentConversion::Boolean;
+        else if (type == JavaTypeObject && parameter == "java.lang.String"_s)
+            conversion = ArgumentConversion::String;
+        m_parameterTypes.append(type);
+        m_parameterClassNames.append(WTF::move(javaClassName));
+        m_argumentConversions.append(conversion);
+    }
+}
+
+const char* JavaMethod::parameterClassNameAt(int i) const
+{
+    ensureParameterTypes();
+    return m_parameterClassNames[i].data();
+}
+
+JavaType JavaMethod::parameterTypeAt(int i) const
+{
+    ensureParameterTypes();
+    return m_parameterTypes[i];
+}
+
+jobject JavaMethod::convertArgument(int i, JSGlobalObject* globalObject, RootObject* rootObject, JSValue value) const
+{
+    ensureParameterTypes();
+    jvalue result;
+    switch (m_argumentConversions[i]) {
+    case ArgumentConversion::Int:
+        if (!value.isInt32())
+            break;
+        result.i = value.asInt32();
+        return jvalueToJObject(result, JavaTypeInt);
+    case ArgumentConversion::Double:
+        if (!value.isNumber())
+            break;
+        result.d = value.asNumber();
+        return jvalueToJObject(result, JavaTypeDouble);
+    case ArgumentConversion::Boolean:
+        if (!value.isBoolean())
+            break;
+        result.z = value.asBoolean();
+        return jvalueToJObject(result, JavaTypeBoolean);
+    case ArgumentConversion::String:
+        if (!value.isString())
+            break;
+        {
+            String stringValue = asString(value)->value(globalObject);
+            return stringValue.toJavaString(getJNIEnv()).releaseLocal();
+        }
+    case ArgumentConversion::Generic:
+        break;
+    }
+
+    JavaType type = m_parameterTypes[i];
+    result = convertValueToJValue(globalObject, rootObject, value, type, m_parameterClassNames[i].data());
+    return jvalueToJObject(result, type);
+}
+
+jobject JavaMethod::reflectedMethod(jobject instance) const
+{
+    if (!m_reflectedMethod) {
+        jmethodID methodId = getMethodID(instance, m_name.utf8(), signature());
+        if (!methodId)
+            return nullptr;
+
+        JNIEnv* env = getJNIEnv();
+        JLClass instanceClass(env->GetObjectClass(instance));
+        m_reflectedMethod = JLObject(env->ToReflectedMethod(instanceClass, methodId, m_isStatic));
+    }
+    return m_reflectedMethod;
+}
+
 #endif // ENABLE(JAVA_BRIDGE)
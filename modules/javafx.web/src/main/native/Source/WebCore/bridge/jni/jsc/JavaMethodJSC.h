@@ -32,11 +32,14 @@
 #include "JavaType.h"
 
 #include "JavaStringJSC.h"
+#include <JavaScriptCore/JSCJSValue.h>
 
 namespace JSC {
 
 namespace Bindings {
 
+class RootObject;
+
 typedef const char* RuntimeType;
 
 class JavaMethod : public Method {
@@ -51,11 +54,41 @@ public:
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
 
+    // The parameter class names and types, converted once for all calls.
+    const char* parameterClassNameAt(int i) const;
+    JavaType parameterTypeAt(int i) const;
+
+    // The java.lang.reflect.Method invoked for JavaScript calls. It is
+    // resolved on the first call and reused, the method belongs to the
+    // class of the instance it was created for, see JavaClass.
+    jobject reflectedMethod(jobject instance) const;
+
+    // Converts a JavaScript argument to the boxed Java object passed to the
+    // reflected method. The common parameter types, int, double, boolean
+    // and String, are converted directly when the value already has the
+    // matching JavaScript type, other arguments go through
+    // convertValueToJValue. The result is the same either way.
+    jobject convertArgument(int i, JSGlobalObject*, RootObject*, JSValue) const;
+
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
 
 private:
+    enum class ArgumentConversion : uint8_t {
+        Generic,
+        Int,
+        Double,
+        Boolean,
+        String
+    };
+
+    void ensureParameterTypes() const;
+
     Vector<WTF::String> m_parameters;
+    mutable Vector<CString> m_parameterClassNames;
+    mutable Vector<JavaType> m_parameterTypes;
+    mutable Vector<ArgumentConversion> m_argumentConversions;
+    mutable JGObject m_reflectedMethod;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
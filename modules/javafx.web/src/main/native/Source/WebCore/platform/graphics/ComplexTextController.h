@@ -58,6 +58,9 @@ namespace WebCore {
 class FontCascade;
 class Font;
 class TextRun;
+#if PLATFORM(JAVA)
+struct JavaShapedRun;
+#endif
 
 enum class GlyphIterationStyle : bool { IncludePartialGlyphs, ByWholeGlyphs };
 
@@ -102,9 +105,9 @@ public:
         }
 
 #if PLATFORM(JAVA)
-        static Ref<ComplexTextRun> create(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
+        static Ref<ComplexTextRun> create(const JavaShapedRun& shapedRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
         {
-            return adoptRef(*new ComplexTextRun(jRun, font, characters, stringLocation, stringLength));
+            return adoptRef(*new ComplexTextRun(shapedRun, font, characters, stringLocation, stringLength));
         }
 #endif
 
@@ -143,7 +146,7 @@ public:
         ComplexTextRun(CTRunRef, const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd);
         ComplexTextRun(hb_buffer_t*, const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd);
 #if PLATFORM(JAVA)
-        ComplexTextRun(JLObject, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength);
+        ComplexTextRun(const JavaShapedRun&, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength);
 #endif
         ComplexTextRun(const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd, bool ltr);
         WEBCORE_EXPORT ComplexTextRun(const Vector<FloatSize>& advances, const Vector<FloatPoint>& origins, const Vector<Glyph>& glyphs, const Vector<unsigned>& stringIndices, FloatSize initialAdvance, const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd, bool ltr);
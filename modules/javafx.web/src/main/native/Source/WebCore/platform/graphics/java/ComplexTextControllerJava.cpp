@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,13 +27,29 @@
 
 #include "ComplexTextController.h"
 #include "FloatRect.h"
+#include "Font.h"
 #include "FontCascade.h"
 
 #include "PlatformJavaClasses.h"
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/text/MakeString.h>
 
 namespace WebCore {
 
+// Glyphs of one java TextRun, copied out so that they can be reused by
+// later layouts of the same text.
+struct JavaShapedRun {
+    unsigned start { 0 };
+    unsigned end { 0 };
+    bool isLTR { true };
+    FloatSize initialAdvance;
+    Vector<CGGlyph> glyphs;
+    Vector<unsigned> charOffsets;
+    Vector<FloatSize> advances;
+};
+
 namespace {
 
 jclass PG_GetTextRun(JNIEnv* env)
@@ -44,127 +60,182 @@ jclass PG_GetTextRun(JNIEnv* env)
     return textRunCls;
 }
 
-bool jIsLTR(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "isLeftToRight",
-        "()Z");
-    ASSERT(mID);
+// Layout written by WCTextRun.getGlyphData()
+constexpr size_t glyphDataHeaderSize = 4 * sizeof(jint);
+constexpr size_t glyphDataSize = 2 * sizeof(jint) + 3 * sizeof(jfloat);
+constexpr size_t initialGlyphDataCapacity = glyphDataHeaderSize + 256 * glyphDataSize;
+
+// A view of the glyph data of one java TextRun. It stays valid until the
+// next run is read.
+class GlyphRunData {
+public:
+    explicit GlyphRunData(std::span<const uint8_t> data)
+        : m_data(data)
+    {
+    }
 
-    return env->CallBooleanMethod(jRun, mID) == JNI_TRUE;
-}
+    unsigned glyphCount() const { return readInt(0); }
+    unsigned start() const { return readInt(sizeof(jint)); }
+    unsigned end() const { return readInt(2 * sizeof(jint)); }
+    bool isLTR() const { return readInt(3 * sizeof(jint)); }
 
-unsigned jGetGlyphCount(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyphCount",
-        "()I");
-    ASSERT(mID);
+    CGGlyph glyph(unsigned i) const { return readInt(glyphOffset(i)); }
+    unsigned charOffset(unsigned i) const { return readInt(glyphOffset(i) + sizeof(jint)); }
+    FloatPoint position(unsigned i) const
+    {
+        return { readFloat(glyphOffset(i) + 2 * sizeof(jint)), readFloat(glyphOffset(i) + 2 * sizeof(jint) + sizeof(jfloat)) };
+    }
+    // FIXME: We don't yet support Y advance from prism.
+    FloatSize advance(unsigned i) const { return { readFloat(glyphOffset(i) + 2 * sizeof(jint) + 2 * sizeof(jfloat)), 0 }; }
 
-    return env->CallIntMethod(jRun, mID);
-}
+private:
+    static size_t glyphOffset(unsigned i) { return glyphDataHeaderSize + i * glyphDataSize; }
 
-unsigned jGetStart(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getStart",
-        "()I");
-    ASSERT(mID);
+    jint readInt(size_t offset) const { return reinterpretCastSpanStartTo<const jint>(m_data.subspan(offset)); }
+    jfloat readFloat(size_t offset) const { return reinterpretCastSpanStartTo<const jfloat>(m_data.subspan(offset)); }
 
-    return env->CallIntMethod(jRun, mID);
-}
+    std::span<const uint8_t> m_data;
+};
 
-unsigned jGetEnd(jobject jRun)
+// Reads a whole run with a single call. The direct buffer is shared by all
+// runs as text is only laid out on the WebKit thread, and is replaced by a
+// larger one when a run does not fit.
+std::optional<GlyphRunData> jGetGlyphRunData(jobject jRun)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "getEnd",
-        "()I");
+        "getGlyphData",
+        "(Ljava/nio/ByteBuffer;)I");
     ASSERT(mID);
 
-    return env->CallIntMethod(jRun, mID);
-}
+    static Vector<uint8_t> storage;
+    static JGObject jBuffer;
 
-unsigned jGetCharOffset(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
-        // Return same value as TextRun.getCharOffset() when there is
-        // no glyph information available.
-        return glyphIndex;
+    if (storage.isEmpty()) {
+        storage.grow(initialGlyphDataCapacity);
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getCharOffset",
-        "(I)I");
-    ASSERT(mID);
+    while (true) {
+        if (!jobject(jBuffer)) {
+            jBuffer = JLObject(env->NewDirectByteBuffer(storage.mutableSpan().data(), storage.size()));
+            if (WTF::CheckAndClearException(env) || !jobject(jBuffer)) {
+                return std::nullopt;
+            }
+        }
 
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
+        jint count = env->CallIntMethod(jRun, mID, jobject(jBuffer));
+        if (WTF::CheckAndClearException(env) || count < 0) {
+            return std::nullopt;
+        }
 
-CGGlyph jGetGlyph(jobject jRun, unsigned glyphIndex)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyph",
-        "(I)I");
-    ASSERT(mID);
+        size_t size = glyphDataHeaderSize + static_cast<size_t>(count) * glyphDataSize;
+        if (size <= storage.size()) {
+            return GlyphRunData(storage.span().first(size));
+        }
 
-    return env->CallIntMethod(jRun, mID, glyphIndex);
+        storage.grow(std::max(size, 2 * storage.size()));
+        jBuffer = JGObject();
+    }
 }
 
-FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
+std::optional<JavaShapedRun> jGetShapedRun(jobject jRun)
 {
-    if (!jGetGlyphCount(jRun)) {
-        return { };
+    auto runData = jGetGlyphRunData(jRun);
+    if (!runData) {
+        return std::nullopt;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyphPosAndAdvance",
-        "(I)[F");
-    ASSERT(mID);
-
-    JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
-                                                              jRun, mID, glyphIndex));
-    WTF::CheckAndClearException(env);
+    JavaShapedRun shapedRun;
+    shapedRun.start = runData->start();
+    shapedRun.end = runData->end();
+    shapedRun.isLTR = runData->isLTR();
 
-    jfloat* pos = static_cast<float*>(env->GetPrimitiveArrayCritical(jpos, 0));
-    FloatRect rect = { pos[0], pos[1], pos[2], pos[3] };
-    env->ReleasePrimitiveArrayCritical(jpos, pos, 0);
-    return rect;
-}
+    unsigned glyphCount = runData->glyphCount();
+    if (!glyphCount) {
+        return shapedRun;
+    }
 
-FloatSize jGetInitialAdvance(JLObject jRun)
-{
     // FIXME(arajkumar): There is no way to get initial advance from Prism Font implementation.
     // With trial and error I found that glyph 0's x,y position can be used as an alternative
     // for initial advance.
-    return jGetGlyphPosAndAdvance(jRun, 0).location() - FloatPoint();
+    shapedRun.initialAdvance = runData->position(0) - FloatPoint();
+
+    shapedRun.glyphs.reserveInitialCapacity(glyphCount);
+    shapedRun.charOffsets.reserveInitialCapacity(glyphCount);
+    shapedRun.advances.reserveInitialCapacity(glyphCount);
+    for (unsigned i = 0; i < glyphCount; ++i) {
+        shapedRun.glyphs.append(runData->glyph(i));
+        shapedRun.charOffsets.append(runData->charOffset(i));
+        shapedRun.advances.append(runData->advance(i));
+    }
+    return shapedRun;
 }
 
+// Shaping results of recently laid out strings. WebCore shapes the same
+// words again on every relayout, and each shaping is a round trip through
+// the Java font code. Entries of fonts that went away are dropped when they
+// are looked up, and the whole cache when it grows too large.
+class ShapingCache {
+public:
+    static ShapingCache& singleton()
+    {
+        static NeverDestroyed<ShapingCache> cache;
+        return cache;
+    }
+
+    const Vector<JavaShapedRun>* find(const Font& font, std::span<const UChar> characters)
+    {
+        if (characters.size() > maxStringLength) {
+            return nullptr;
+        }
+
+        auto it = m_map.find(std::make_pair(&font, String(characters)));
+        if (it == m_map.end()) {
+            return nullptr;
+        }
+        if (it->value.font.get() != &font) {
+            m_map.remove(it);
+            return nullptr;
+        }
+        return &it->value.runs;
+    }
+
+    void add(const Font& font, std::span<const UChar> characters, Vector<JavaShapedRun>&& runs)
+    {
+        if (characters.size() > maxStringLength) {
+            return;
+        }
+        if (m_map.size() >= maxSize) {
+            m_map.clear();
+        }
+        m_map.set(std::make_pair(&font, String(characters)), Entry { font, WTF::move(runs) });
+    }
+
+private:
+    static constexpr size_t maxStringLength = 128;
+    static constexpr unsigned maxSize = 2048;
+
+    struct Entry {
+        SingleThreadWeakPtr<const Font> font;
+        Vector<JavaShapedRun> runs;
+    };
+
+    HashMap<std::pair<const Font*, String>, Entry> m_map;
+};
+
 }
 
-ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
-    : m_initialAdvance(jGetInitialAdvance(jRun))
+ComplexTextController::ComplexTextRun::ComplexTextRun(const JavaShapedRun& shapedRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
+    : m_initialAdvance(shapedRun.initialAdvance)
     , m_font(font)
     , m_characters(characters, stringLength)
     , m_stringLength(stringLength)
-    , m_indexBegin(jGetStart(jRun))
-    , m_indexEnd(jGetEnd(jRun))
-    , m_glyphCount(jGetGlyphCount(jobject(jRun)))
+    , m_indexBegin(shapedRun.start)
+    , m_indexEnd(shapedRun.end)
+    , m_glyphCount(shapedRun.glyphs.size())
     , m_stringLocation(stringLocation)
-    , m_isLTR(jIsLTR(jobject(jRun)))
+    , m_isLTR(shapedRun.isLTR)
 {
     // Handle empty string runs (line breaks, etc.)
     if (m_stringLength == 0) {
@@ -195,16 +266,15 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
         // java TextRun will have indicies relative to it's text. So it has to
         // be converted to absolute index w.r.t WebCore String.
         // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
-        m_coreTextIndices[i] = m_indexBegin + jGetCharOffset(jRun, i);
+        m_coreTextIndices[i] = m_indexBegin + shapedRun.charOffsets[i];
 
-        m_glyphs[i]= jGetGlyph(jRun, i);
+        m_glyphs[i] = shapedRun.glyphs[i];
         if (m_font->isZeroWidthSpaceGlyph(m_glyphs[i])) {
             m_baseAdvances[i] = { };
             continue;
         }
 
-        auto glyphBox = jGetGlyphPosAndAdvance(jRun, i);
-        m_baseAdvances[i] = glyphBox.size();
+        m_baseAdvances[i] = shapedRun.advances[i];
     }
 }
 
@@ -217,6 +287,13 @@ void ComplexTextController::collectComplexTextRunsForCharacters(std::span<const
         return;
     }
 
+    auto& shapingCache = ShapingCache::singleton();
+    if (auto* shapedRuns = shapingCache.find(*font, characters)) {
+        for (auto& shapedRun : *shapedRuns)
+            m_complexTextRuns.append(ComplexTextRun::create(shapedRun, *font, characters.data(), stringLocation, characters.size()));
+        return;
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID getTextRuns_mID = env->GetMethodID(
         PG_GetFontClass(env),
@@ -236,9 +313,24 @@ void ComplexTextController::collectComplexTextRunsForCharacters(std::span<const
         return;
     }
 
+    Vector<JavaShapedRun> shapedRuns;
+    bool complete = true;
     for (auto i = 0; i < env->GetArrayLength(jobjectArray(jRuns)); i++) {
-        auto jRun = env->GetObjectArrayElement(jobjectArray(jRuns), i);
-        m_complexTextRuns.append(ComplexTextRun::create(jRun, *font, characters.data(), stringLocation, characters.size()));
+        JLObject jRun(env->GetObjectArrayElement(jobjectArray(jRuns), i));
+        auto shapedRun = jGetShapedRun(jRun);
+        if (!shapedRun) {
+            complete = false;
+            shapedRun = JavaShapedRun { };
+        }
+        shapedRuns.append(WTF::move(*shapedRun));
+    }
+
+    for (auto& shapedRun : shapedRuns)
+        m_complexTextRuns.append(ComplexTextRun::create(shapedRun, *font, characters.data(), stringLocation, characters.size()));
+
+    // Runs that could not be read are not kept, the next layout asks again
+    if (complete) {
+        shapingCache.add(*font, characters, WTF::move(shapedRuns));
     }
 }
 
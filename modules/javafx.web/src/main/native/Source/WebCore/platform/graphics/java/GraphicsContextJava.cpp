@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -151,6 +151,37 @@ GraphicsContextJava::~GraphicsContextJava()
     delete m_platformContext;
 }
 
+// How far a stroke may extend beyond the outline of the shape. Miter joins
+// are the worst case; 10 is the Java default for the miter limit, which
+// is in effect until WebCore sets its own.
+static float strokeOutset(GraphicsContextJava& gc, float lineWidth)
+{
+    return lineWidth * std::max(10.0f, gc.platformContext()->miterLimit()) / 2;
+}
+
+// Returns true if a primitive covering the given rectangle in user space
+// cannot touch any pixel of the cull rect, so that it does not need to go
+// through the RenderingQueue and the Java decoder at all.
+bool GraphicsContextJava::isCulled(const FloatRect& rect, float outset, CompositeOperator op) const
+{
+    const auto& cullRect = m_platformContext->cullRect();
+    if (!cullRect) {
+        return false;
+    }
+    // Shadows are painted outside of the primitive, and the composite
+    // operators other than source-over change the pixels around it.
+    if (dropShadow()
+        || op != CompositeOperator::SourceOver
+        || compositeOperation() != CompositeOperator::SourceOver
+        || blendMode() != BlendMode::Normal) {
+        return false;
+    }
+    FloatRect bounds(rect);
+    // One extra pixel for antialiasing.
+    bounds.inflate(outset + 1);
+    return !m_state.transform.mapRect(bounds).intersects(*cullRect);
+}
+
 void GraphicsContextJava::save(GraphicsContextState::Purpose) {
     GraphicsContext::save();
     savePlatformState();
@@ -183,7 +214,7 @@ void GraphicsContextJava::restorePlatformState()
 void GraphicsContextJava::drawRect(const FloatRect& rect, float borderThickness = 1) // todo tav rect changed from IntRect to FloatRect
 {
     UNUSED_PARAM(borderThickness);
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(rect, strokeThickness()))
         return;
 
     platformContext()->rq().freeSpace(20)
@@ -205,7 +236,7 @@ void GraphicsContextJava::drawLine(const FloatPoint& point1, const FloatPoint& p
 // This method is only used to draw the little circles used in lists.
 void GraphicsContextJava::drawEllipse(const FloatRect& rect)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(rect, strokeThickness()))
         return;
 
     platformContext()->rq().freeSpace(20)
@@ -227,7 +258,7 @@ void GraphicsContextJava::drawEllipse(const FloatRect& rect)
 
 void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(rect))
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
@@ -240,7 +271,7 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
 
 void GraphicsContextJava::fillRect(const FloatRect& rect, RequiresClipToRect requiresClip)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(rect))
         return;
 
     if (fillPattern()) {
@@ -652,7 +683,7 @@ void GraphicsContextJava::clearRect(const FloatRect& rect)
 
 void GraphicsContextJava::strokeRect(const FloatRect& rect, float lineWidth)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(rect, strokeOutset(*this, lineWidth)))
         return;
 
     if (strokeGradient()) {
@@ -745,7 +776,7 @@ void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, Bl
 
 void GraphicsContextJava::strokePath(const Path& path)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(path.fastBoundingRect(), strokeOutset(*this, strokeThickness())))
         return;
 
     if (strokeGradient()) {
@@ -806,7 +837,7 @@ void GraphicsContextJava::clipOut(const FloatRect& rect)
 
 void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const FloatRect& destRect, const FloatRect& srcRect, ImagePaintingOptions options)
 {
-    if (!image || !image->getImage())
+    if (!image || !image->getImage() || isCulled(destRect, 0, options.compositeOperator()))
         return;
 
     savePlatformState();
@@ -872,7 +903,7 @@ void GraphicsContextJava::drawPlatformPattern(const PlatformImagePtr& image, con
 
 void GraphicsContextJava::fillPath(const Path& path)
 {
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(path.fastBoundingRect()))
         return;
 
     if (fillPattern()) {
@@ -932,7 +963,7 @@ void GraphicsContextJava::scale(const FloatSize& size)
 void GraphicsContextJava::fillRoundedRect(const FloatRoundedRect& rect, const Color& color, BlendMode blendMode) // todo tav Int to Float
 {
     UNUSED_PARAM(blendMode);
-    if (paintingDisabled())
+    if (paintingDisabled() || isCulled(rect.rect()))
         return;
 
     if (rect.radii().topLeft().width() == rect.radii().topRight().width() &&
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -144,6 +144,8 @@ public:
     void setPlatformCompositeOperation(CompositeOperator op, BlendMode);
     void setURLForRect(const URL&, const FloatRect&) override;
 
+    bool isCulled(const FloatRect& rect, float outset = 0, CompositeOperator = CompositeOperator::SourceOver) const;
+
     PlatformGraphicsContext* m_platformContext;
 
     void didUpdateState(GraphicsContextState&) override;
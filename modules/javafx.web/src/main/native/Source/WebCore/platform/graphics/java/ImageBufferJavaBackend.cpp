@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -79,7 +79,12 @@ std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
         return nullptr;
     }
 
-    auto context = makeUnique<GraphicsContextJava>(new PlatformContextJava(wcRenderQueue, true));
+    auto platformContext = new PlatformContextJava(wcRenderQueue, true);
+    // The image is allocated at the resolution scale, so is the cull rect.
+    FloatSize cullSize(backendSize);
+    cullSize.scale(std::max(1.0f, parameters.resolutionScale));
+    platformContext->setCullRect(FloatRect(FloatPoint(), cullSize));
+    auto context = makeUnique<GraphicsContextJava>(platformContext);
 
     auto platformImage = ImageJava::create(image, context->platformContext()->rq_ref(),
         backendSize.width(), backendSize.height());
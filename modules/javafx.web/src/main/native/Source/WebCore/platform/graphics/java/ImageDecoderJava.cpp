@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,7 +29,6 @@
 
 #include "NotImplemented.h"
 #include "SharedBuffer.h"
-#include "SharedBuffer.h"
 #include "PlatformJavaClasses.h"
 #include "Logging.h"
 
@@ -109,20 +108,21 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
     while (m_receivedDataSize < data.size()) {
-        const auto& someData = data.getSomeData(m_receivedDataSize);
-        unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.span().data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+        auto someData = data.getSomeData(m_receivedDataSize);
+        auto span = someData.span();
+        // Java reads the segment in place. The view keeps it alive
+        // until the Java decoder is destroyed, see ~ImageDecoderJava.
+        JLObject jBuffer(env->NewDirectByteBuffer(const_cast<uint8_t*>(span.data()), span.size()));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
+            m_dataViews.append(WTF::move(someData));
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer);
             WTF::CheckAndClearException(env);
         }
-        m_receivedDataSize += length;
+        m_receivedDataSize += span.size();
     }
 
     if (allDataReceived) {
@@ -134,6 +134,10 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
 
 bool ImageDecoderJava::isSizeAvailable() const
 {
+    // The size does not change once known, do not ask Java again.
+    if (!m_size.isEmpty())
+        return true;
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -159,6 +163,9 @@ bool ImageDecoderJava::isSizeAvailable() const
 
 size_t ImageDecoderJava::frameCount() const
 {
+    if (m_frameCount)
+        return m_frameCount;
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -173,6 +180,11 @@ size_t ImageDecoderJava::frameCount() const
     jint count = env->CallIntMethod(m_nativeDecoder, midGetFrameCount);
     WTF::CheckAndClearException(env);
 
+    // With all data received the Java decoder decodes all frames,
+    // so the count is final.
+    if (m_isAllDataReceived && count > 0)
+        m_frameCount = count;
+
     return count < 1
         ? 1
         : count;
@@ -221,6 +233,9 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
 
 WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
 {
+    if (idx < m_frameInfos.size() && m_frameInfos[idx])
+        return m_frameInfos[idx]->duration;
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -234,6 +249,7 @@ WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
                         m_nativeDecoder,
                         midGetDuration,
                         idx);
+    WTF::CheckAndClearException(env);
     return WTF::Seconds::fromMilliseconds(duration);
 }
 
@@ -263,6 +279,9 @@ IntSize ImageDecoderJava::size() const
 
 IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
 {
+    if (idx < m_frameInfos.size() && m_frameInfos[idx])
+        return m_frameInfos[idx]->size;
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -276,6 +295,7 @@ IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
                         m_nativeDecoder,
                         midGetFrameSize,
                         idx));
+    WTF::CheckAndClearException(env);
     if (!jsize) {
         return m_size;
     }
@@ -301,6 +321,9 @@ bool ImageDecoderJava::frameHasAlphaAtIndex(size_t) const
 
 bool ImageDecoderJava::frameIsCompleteAtIndex(size_t idx) const
 {
+    if (idx < m_frameInfos.size() && m_frameInfos[idx])
+        return true;
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return false;
@@ -310,9 +333,21 @@ bool ImageDecoderJava::frameIsCompleteAtIndex(size_t idx) const
         "getFrameCompleteStatus",
         "(I)Z");
     ASSERT(midGetFrameIsComplete);
-    return (bool)env->CallBooleanMethod(m_nativeDecoder,
+    bool isComplete = env->CallBooleanMethod(m_nativeDecoder,
             midGetFrameIsComplete,
             idx);
+    WTF::CheckAndClearException(env);
+
+    // The properties of a complete frame do not change anymore. They are
+    // queried for every paint, so keep them here rather than calling Java.
+    if (isComplete) {
+        auto size = frameSizeAtIndex(idx);
+        auto duration = frameDurationAtIndex(idx);
+        if (idx >= m_frameInfos.size())
+            m_frameInfos.grow(idx + 1);
+        m_frameInfos[idx] = FrameInfo { size, duration };
+    }
+    return isComplete;
 }
 
 unsigned ImageDecoderJava::frameBytesAtIndex(size_t idx, SubsamplingLevel samplingLevel) const
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,10 @@
 
 namespace WebCore {
 
+// Forwards the encoded data to com.sun.webkit.graphics.WCImageDecoder, which
+// decodes with the javafx.graphics image loaders: JPEG through libjpeg in
+// the javafx_iio library, PNG, GIF and BMP in Java. Decoding is synchronous
+// and at full size. Only the frame properties are cached here.
 class ImageDecoderJava : public ImageDecoder {
     WTF_MAKE_TZONE_ALLOCATED(ImageDecoderJava);
 public:
@@ -84,7 +88,17 @@ protected:
     mutable EncodedDataStatus m_encodedDataStatus { EncodedDataStatus::Unknown };
     // Native Handle for Java object.
     JGObject m_nativeDecoder;
+    // The data passed to the Java decoder. It is not copied, so it has to
+    // outlive the Java decoder.
+    Vector<SharedBufferDataView> m_dataViews;
     mutable IntSize m_size;
+    mutable size_t m_frameCount { 0 };
+    // The properties of the frames Java reported as complete.
+    struct FrameInfo {
+        IntSize size;
+        WTF::Seconds duration;
+    };
+    mutable Vector<std::optional<FrameInfo>> m_frameInfos;
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "FloatRect.h"
 #include "GraphicsContext.h"
 #include "Path.h"
 #include "RenderingQueue.h"
@@ -40,7 +41,12 @@ namespace WebCore {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
         PlatformContextJava(const JLObject& jRQ, RefPtr<RQRef> jTheme, bool autoFlush = false)
-            : m_rq(RenderingQueue::create(jRQ, com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT, autoFlush))
+            : m_rq(RenderingQueue::create(jRQ, RenderingQueue::DEFAULT_CAPACITY, autoFlush))
+            , m_jRenderTheme(jTheme)
+        {}
+
+        PlatformContextJava(const JLObject& jRQ, Ref<ByteBufferPool>&& bufferPool, RefPtr<RQRef> jTheme, bool autoFlush = false)
+            : m_rq(RenderingQueue::create(jRQ, WTF::move(bufferPool), autoFlush))
             , m_jRenderTheme(jTheme)
         {}
 
@@ -64,6 +70,17 @@ namespace WebCore {
             m_jRenderTheme = jTheme;
         }
 
+        // The area that is going to be painted, in the coordinate space
+        // the context starts with. Primitives that fall entirely outside
+        // of it are not sent to Java, see [GraphicsContextJava::isCulled].
+        const std::optional<FloatRect>& cullRect() const {
+            return m_cullRect;
+        }
+
+        void setCullRect(const FloatRect& cullRect) {
+            m_cullRect = cullRect;
+        }
+
         void beginPath() {
             m_path.clear();
         }
@@ -122,6 +139,7 @@ namespace WebCore {
     private:
         RefPtr<RenderingQueue> m_rq;
         RefPtr<RQRef> m_jRenderTheme;
+        std::optional<FloatRect> m_cullRect;
         Path m_path;
         // Buffer the last set stroke styles on the native side to make them
         // acessible outside the java graphics context
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,15 +45,56 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+RefPtr<ByteBuffer> ByteBufferPool::acquire(int size)
+{
+    if (size > m_capacity) {
+        // Oversized buffers are rare and are not worth keeping around.
+        ++m_missCount;
+        return ByteBuffer::create(size);
+    }
+
+    RefPtr<ByteBuffer> buffer;
+    if (m_freeBuffers.isEmpty()) {
+        ++m_missCount;
+        buffer = ByteBuffer::create(m_capacity);
+    } else {
+        ++m_hitCount;
+        buffer = m_freeBuffers.takeLast();
+    }
+    buffer->setPool(this);
+    return buffer;
+}
+
+void ByteBufferPool::recycle(Ref<ByteBuffer>&& buffer)
+{
+    ASSERT(buffer->capacity() == m_capacity);
+    buffer->reset();
+    if (m_freeBuffers.size() < MAX_POOLED_BUFFER_COUNT) {
+        m_freeBuffers.append(WTF::move(buffer));
+    }
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
     int capacity,
     bool autoFlush)
+{
+    return create(
+        jRQ,
+        ByteBufferPool::create(capacity),
+        autoFlush);
+}
+
+/*static*/
+RefPtr<RenderingQueue> RenderingQueue::create(
+    const JLObject &jRQ,
+    Ref<ByteBufferPool>&& pool,
+    bool autoFlush)
 {
     return adoptRef(new RenderingQueue(
         jRQ,
-        capacity,
+        WTF::move(pool),
         autoFlush));
 }
 
@@ -65,7 +106,7 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = m_bufferPool->acquire(size);
     }
     return *this;
 }
@@ -106,7 +147,7 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;I)V");
     ASSERT(midFwkAddBuffer);
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
@@ -114,7 +155,8 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(m_buffer->directByteBuffer(env)),
+        (jint)m_buffer->position());
     WTF::CheckAndClearException(env);
 
     m_buffer = nullptr;
@@ -139,7 +181,15 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            RefPtr<ByteBuffer> buffer = a2bb.take(key);
+            if (!buffer) {
+                continue;
+            }
+            // The pool is kept alive by the local reference while the buffer
+            // is recycled, even if its RenderingQueue has already gone.
+            if (RefPtr<ByteBufferPool> pool = buffer->takePool()) {
+                pool->recycle(buffer.releaseNonNull());
+            }
         }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,10 +32,12 @@
 #include <wtf/java/DbgUtils.h>
 
 #include "RQRef.h"
+#include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
 class RQRef;
+class ByteBufferPool;
 
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
@@ -44,15 +46,34 @@ public:
         return adoptRef(new ByteBuffer(capacity));
     }
 
-    JLObject createDirectByteBuffer(JNIEnv* env) {
+    // The java.nio wrapper spans the whole capacity and is created only once,
+    // so a recycled buffer hands the same object back to Java. The number of
+    // valid bytes is passed to Java separately, see [RenderingQueue::flushBuffer].
+    JLObject directByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        if (!m_nio_holder) {
+            m_nio_holder = JLObject(env->NewDirectByteBuffer(m_buffer, m_capacity));
+        }
+        return m_nio_holder;
     }
 
     char* bufferAddress() { return m_buffer; }
 
+    int capacity() const { return m_capacity; }
+
+    int position() const { return m_position; }
+
+    // Drops the references collected while the buffer was in use and
+    // rewinds it, so that it can be handed out again by its pool.
+    void reset() {
+        m_position = 0;
+        m_refList.clear();
+    }
+
+    void setPool(RefPtr<ByteBufferPool>&& pool) { m_pool = WTF::move(pool); }
+
+    RefPtr<ByteBufferPool> takePool() { return WTF::move(m_pool); }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -92,6 +113,47 @@ private:
     int m_position;
     JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
+    // The pool the buffer is returned to on release. Only set while the
+    // buffer is in use, so that pooled buffers do not keep the pool alive.
+    RefPtr<ByteBufferPool> m_pool;
+};
+
+/*
+ * A pool of ByteBuffers of the same capacity shared by the RenderingQueues
+ * of a page. Buffers released by Java in [WCRenderQueue.twkRelease] are
+ * returned here together with their java.nio wrappers instead of being
+ * freed, which saves a malloc/free pair and a JNI direct buffer creation
+ * for every buffer sent to Java.
+ *
+ * The pool is only accessed on the Event thread.
+ */
+class ByteBufferPool : public RefCounted<ByteBufferPool> {
+    RQ_LOG_INSTANCE_COUNT(ByteBufferPool)
+public:
+    static const size_t MAX_POOLED_BUFFER_COUNT = 16;
+
+    static Ref<ByteBufferPool> create(int capacity) {
+        return adoptRef(*new ByteBufferPool(capacity));
+    }
+
+    int capacity() const { return m_capacity; }
+
+    RefPtr<ByteBuffer> acquire(int size);
+    void recycle(Ref<ByteBuffer>&& buffer);
+
+    size_t pooledBufferCount() const { return m_freeBuffers.size(); }
+    uint64_t hitCount() const { return m_hitCount; }
+    uint64_t missCount() const { return m_missCount; }
+
+private:
+    ByteBufferPool(int capacity) :
+        m_capacity(capacity)
+    {}
+
+    int m_capacity;
+    Vector< RefPtr<ByteBuffer> > m_freeBuffers;
+    uint64_t m_hitCount { 0 };
+    uint64_t m_missCount { 0 };
 };
 
 /*
@@ -108,13 +170,23 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
     RQ_LOG_INSTANCE_COUNT(RenderingQueue)
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
+    static const int DEFAULT_CAPACITY = com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / MAX_BUFFER_COUNT;
 
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
         int capacity,
         bool autoFlush);
 
-    int capacity() { return m_capacity; }
+    // Creates a queue taking its buffers from the given pool. The
+    // capacity of the queue is the capacity of the pool.
+    static RefPtr<RenderingQueue> create(
+        const JLObject &jRQ,
+        Ref<ByteBufferPool>&& pool,
+        bool autoFlush);
+
+    int capacity() { return m_bufferPool->capacity(); }
+
+    ByteBufferPool& bufferPool() { return m_bufferPool.get(); }
 
     RenderingQueue& operator << (RefPtr<RQRef> r) {
         m_buffer->putRef(r);
@@ -153,9 +225,9 @@ public:
     }
 
 private:
-    RenderingQueue(const JLObject& jRQ, int capacity, bool autoFlush) :
+    RenderingQueue(const JLObject& jRQ, Ref<ByteBufferPool>&& pool, bool autoFlush) :
         m_rqoRenderingQueue(RQRef::create(jRQ)),
-        m_capacity(capacity),
+        m_bufferPool(WTF::move(pool)),
         m_autoFlush(autoFlush),
         m_buffer(nullptr)
     {}
@@ -167,7 +239,7 @@ private:
     //callback in destructor. Texture need to be released.
     RefPtr<RQRef> m_rqoRenderingQueue;
 
-    int m_capacity;
+    Ref<ByteBufferPool> m_bufferPool;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
 
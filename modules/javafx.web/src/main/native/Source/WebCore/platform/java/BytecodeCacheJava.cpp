@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BytecodeCacheJava.h"
+
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/JSCBytecodeCacheVersion.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <wtf/FileHandle.h>
+#include <wtf/FileSystem.h>
+#include <wtf/MappedFileData.h>
+#include <wtf/SHA1.h>
+#include <wtf/URL.h>
+#include <wtf/text/MakeString.h>
+
+namespace WebCore {
+
+Ref<BytecodeCacheJava> BytecodeCacheJava::create(const String& directory)
+{
+    return adoptRef(*new BytecodeCacheJava(directory));
+}
+
+BytecodeCacheJava::BytecodeCacheJava(const String& directory)
+    : m_directory(directory)
+{
+    FileSystem::makeAllDirectories(m_directory);
+}
+
+String BytecodeCacheJava::cachePath(const URL& url, unsigned sourceHash) const
+{
+    // URLs can be arbitrarily long, so only a digest of the URL goes into
+    // the file name.
+    SHA1 sha1;
+    sha1.addUTF8Bytes(url.string());
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+
+    auto fileName = makeString(hex(JSC::computeJSCBytecodeCacheVersion(), 8), '-', hex(sourceHash, 8), '-', String::fromLatin1(SHA1::hexDigest(digest).data()), ".bytecode-cache"_s);
+    return FileSystem::pathByAppendingComponent(m_directory, fileName);
+}
+
+RefPtr<JSC::CachedBytecode> BytecodeCacheJava::load(const URL& url, unsigned sourceHash)
+{
+    auto handle = FileSystem::openFile(cachePath(url, sourceHash), FileSystem::FileOpenMode::Read, FileSystem::FileAccessPermission::User, { FileSystem::FileLockMode::Shared, FileSystem::FileLockMode::Nonblocking });
+    if (!handle) {
+        ++m_missCount;
+        return nullptr;
+    }
+
+    auto mappedFileData = handle.map(FileSystem::MappedFileMode::Private);
+    if (!mappedFileData || !mappedFileData->size()) {
+        ++m_missCount;
+        return nullptr;
+    }
+
+    ++m_hitCount;
+    return JSC::CachedBytecode::create(WTF::move(*mappedFileData));
+}
+
+void BytecodeCacheJava::store(const URL& url, unsigned sourceHash, const JSC::CachedBytecode& cachedBytecode)
+{
+    if (!cachedBytecode.hasUpdates())
+        return;
+
+    auto handle = FileSystem::openFile(cachePath(url, sourceHash), FileSystem::FileOpenMode::ReadWrite, FileSystem::FileAccessPermission::User, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking });
+    if (!handle)
+        return;
+
+    auto fileSize = handle.size();
+    if (!fileSize)
+        return;
+
+    // Another page may have written the entry since it was mapped; its
+    // updates were computed against a different payload, so keep the file.
+    size_t cacheFileSize;
+    if (!WTF::convertSafely(*fileSize, cacheFileSize) || cacheFileSize != cachedBytecode.size())
+        return;
+
+    if (!handle.truncate(cachedBytecode.sizeForUpdate()))
+        return;
+
+    cachedBytecode.commitUpdates([&](off_t offset, std::span<const uint8_t> data) {
+        auto result = handle.seek(offset, FileSystem::FileSeekOrigin::Beginning);
+        ASSERT_UNUSED(result, !!result);
+        auto bytesWritten = handle.write(data);
+        ASSERT_UNUSED(bytesWritten, bytesWritten == data.size());
+    });
+}
+
+void BytecodeCacheJava::addFunctionUpdate(JSC::CachedBytecode& cachedBytecode, const JSC::UnlinkedFunctionExecutable* executable, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock)
+{
+    JSC::BytecodeCacheError error;
+    RefPtr functionBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (functionBytecode && !error.isValid())
+        cachedBytecode.addFunctionUpdate(executable, kind, *functionBytecode);
+}
+
+} // namespace WebCore
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/CodeSpecializationKind.h>
+#include <wtf/Forward.h>
+#include <wtf/RefCounted.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+class CachedBytecode;
+class UnlinkedFunctionCodeBlock;
+class UnlinkedFunctionExecutable;
+}
+
+namespace WebCore {
+
+// On-disk cache of the bytecode JavaScriptCore generates for external
+// scripts. Entries are keyed by the script URL, the source hash and the
+// JSC bytecode cache version, so that files produced by a different
+// build of the library are never mapped.
+class BytecodeCacheJava final : public RefCounted<BytecodeCacheJava> {
+public:
+    WEBCORE_EXPORT static Ref<BytecodeCacheJava> create(const String& directory);
+
+    RefPtr<JSC::CachedBytecode> load(const URL&, unsigned sourceHash);
+    void store(const URL&, unsigned sourceHash, const JSC::CachedBytecode&);
+    void addFunctionUpdate(JSC::CachedBytecode&, const JSC::UnlinkedFunctionExecutable*, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*);
+
+    const String& directory() const { return m_directory; }
+    uint64_t hitCount() const { return m_hitCount; }
+    uint64_t missCount() const { return m_missCount; }
+
+private:
+    explicit BytecodeCacheJava(const String& directory);
+
+    String cachePath(const URL&, unsigned sourceHash) const;
+
+    String m_directory;
+    uint64_t m_hitCount { 0 };
+    uint64_t m_missCount { 0 };
+};
+
+} // namespace WebCore
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "MemoryPressureMonitorJava.h"
+
+#include "MemoryRelease.h"
+#include <stdio.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/MemoryPressureHandler.h>
+
+namespace WebCore {
+
+static constexpr Seconds s_pollInterval { 5_s };
+static constexpr Seconds s_holdOffTime { 30_s };
+static constexpr unsigned s_memoryPressurePercentageThreshold = 90;
+static constexpr unsigned s_memoryPressurePercentageThresholdCritical = 95;
+
+static std::optional<unsigned> systemMemoryUsedPercentage()
+{
+#if OS(LINUX)
+    FILE* file = fopen("/proc/meminfo", "r");
+    if (!file)
+        return std::nullopt;
+
+    unsigned long long memoryTotal = 0;
+    unsigned long long memoryAvailable = 0;
+    char line[128];
+    while ((!memoryTotal || !memoryAvailable) && fgets(line, sizeof(line), file)) {
+        unsigned long long value;
+        if (sscanf(line, "MemTotal: %llu kB", &value) == 1)
+            memoryTotal = value;
+        else if (sscanf(line, "MemAvailable: %llu kB", &value) == 1)
+            memoryAvailable = value;
+    }
+    fclose(file);
+
+    if (!memoryTotal || memoryAvailable > memoryTotal)
+        return std::nullopt;
+    return static_cast<unsigned>((memoryTotal - memoryAvailable) * 100 / memoryTotal);
+#else
+    return std::nullopt;
+#endif
+}
+
+void MemoryPressureMonitorJava::install()
+{
+    static NeverDestroyed<MemoryPressureMonitorJava> monitor;
+}
+
+MemoryPressureMonitorJava::MemoryPressureMonitorJava()
+    : m_pollTimer([this] { pollTimerFired(); })
+{
+    MemoryPressureHandler::singleton().setLowMemoryHandler([](Critical critical, Synchronous synchronous) {
+        releaseMemory(critical, synchronous);
+        // releaseMemory() only scavenges the allocator for critical or
+        // synchronous requests, but returning free pages is the point here.
+        WTF::releaseFastMallocFreeMemory();
+    });
+
+    if (systemMemoryUsedPercentage())
+        m_pollTimer.startRepeating(s_pollInterval);
+}
+
+void MemoryPressureMonitorJava::pollTimerFired()
+{
+    auto usedPercentage = systemMemoryUsedPercentage();
+    if (!usedPercentage)
+        return;
+
+    auto& memoryPressureHandler = MemoryPressureHandler::singleton();
+    if (*usedPercentage < s_memoryPressurePercentageThreshold) {
+        memoryPressureHandler.setMemoryPressureStatus(SystemMemoryPressureStatus::Normal);
+        return;
+    }
+
+    bool isCritical = *usedPercentage >= s_memoryPressurePercentageThresholdCritical;
+    memoryPressureHandler.setMemoryPressureStatus(isCritical ? SystemMemoryPressureStatus::Critical : SystemMemoryPressureStatus::Warning);
+
+    auto now = MonotonicTime::now();
+    if (now < m_holdOffUntil)
+        return;
+    m_holdOffUntil = now + s_holdOffTime;
+
+    memoryPressureHandler.releaseMemory(isCritical ? Critical::Yes : Critical::No);
+}
+
+} // namespace WebCore
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "Timer.h"
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+
+namespace WebCore {
+
+// Polls the system memory usage and, when it runs high, asks
+// WTF::MemoryPressureHandler to release WebCore caches and return free
+// allocator pages to the OS. WebKit ports normally get these events from
+// a UI process; in the Java port nothing else would deliver them.
+class MemoryPressureMonitorJava final {
+    WTF_MAKE_NONCOPYABLE(MemoryPressureMonitorJava);
+public:
+    WEBCORE_EXPORT static void install();
+
+private:
+    friend class NeverDestroyed<MemoryPressureMonitorJava>;
+    MemoryPressureMonitorJava();
+
+    void pollTimerFired();
+
+    Timer m_pollTimer;
+    MonotonicTime m_holdOffUntil;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #include "config.h"
 
 #include "PageSupplementJava.h"
+#include "CachedScriptSourceProvider.h"
 #include "Page.h"
 #include "Frame.h"
 #include "DocumentPage.h"
@@ -39,6 +40,37 @@ PageSupplementJava::PageSupplementJava(const JLObject& webPage)
 {
 }
 
+PageSupplementJava::~PageSupplementJava()
+{
+    commitCachedBytecode();
+}
+
+void PageSupplementJava::setBytecodeCache(RefPtr<BytecodeCacheJava>&& bytecodeCache)
+{
+    commitCachedBytecode();
+    m_bytecodeCache = WTF::move(bytecodeCache);
+}
+
+void PageSupplementJava::addBytecodeCacheClient(FrameIdentifier frameID, Ref<CachedScriptSourceProvider>&& provider)
+{
+    m_bytecodeCacheClients.add(frameID, Vector<Ref<CachedScriptSourceProvider>> { }).iterator->value.append(WTF::move(provider));
+}
+
+void PageSupplementJava::commitCachedBytecode(FrameIdentifier frameID)
+{
+    for (auto& provider : m_bytecodeCacheClients.take(frameID))
+        provider->commitCachedBytecode();
+}
+
+void PageSupplementJava::commitCachedBytecode()
+{
+    auto bytecodeCacheClients = std::exchange(m_bytecodeCacheClients, { });
+    for (auto& providers : bytecodeCacheClients.values()) {
+        for (auto& provider : providers)
+            provider->commitCachedBytecode();
+    }
+}
+
 // static
 ASCIILiteral PageSupplementJava::supplementName()
 {
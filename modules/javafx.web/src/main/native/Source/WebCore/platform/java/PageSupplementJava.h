@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,12 +25,17 @@
 
 #pragma once
 
+#include "BytecodeCacheJava.h"
+#include "FrameIdentifier.h"
 #include "Supplementable.h"
+#include <wtf/HashMap.h>
+#include <wtf/Vector.h>
 #include <wtf/java/JavaRef.h>
 #include <jni.h>
 
 namespace WebCore {
 
+class CachedScriptSourceProvider;
 class Page;
 class Frame;
 
@@ -38,15 +43,28 @@ class PageSupplementJava final : public Supplement<WebCore::Page> {
     WTF_MAKE_NONCOPYABLE(PageSupplementJava);
   public:
     WEBCORE_EXPORT explicit PageSupplementJava(const JLObject& webPage);
+    ~PageSupplementJava();
 
     WEBCORE_EXPORT JLObject jWebPage() const { return m_webPage; }
 
+    BytecodeCacheJava* bytecodeCache() const { return m_bytecodeCache.get(); }
+    WEBCORE_EXPORT void setBytecodeCache(RefPtr<BytecodeCacheJava>&&);
+
+    // JSC keeps the source providers of evaluated scripts alive in its code
+    // cache, so their bytecode is written out when the frame's document goes
+    // away rather than when the providers are destroyed.
+    void addBytecodeCacheClient(FrameIdentifier, Ref<CachedScriptSourceProvider>&&);
+    void commitCachedBytecode(FrameIdentifier);
+    void commitCachedBytecode();
+
     WEBCORE_EXPORT static ASCIILiteral supplementName();
     WEBCORE_EXPORT static PageSupplementJava* from(Frame*);
     WEBCORE_EXPORT static PageSupplementJava* from(Page*);
 
   private:
     JGObject m_webPage;
+    RefPtr<BytecodeCacheJava> m_bytecodeCache;
+    HashMap<FrameIdentifier, Vector<Ref<CachedScriptSourceProvider>>> m_bytecodeCacheClients;
 };
 
 }
@@ -28,29 +28,149 @@
 
 #if PLATFORM(JAVA)
 
-#include "NotImplemented.h"
+#include "com_sun_webkit_network_DNSResolver.h"
+#include <wtf/CompletionHandler.h>
 #include <wtf/TZoneMallocInlines.h>
+#include <wtf/java/JavaEnv.h>
 
 namespace WebCore {
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+static jclass GetDNSResolverClass(JNIEnv* env)
 {
-    notImplemented();
+    static JGClass dnsResolverClass(env->FindClass(
+            "com/sun/webkit/network/DNSResolver"));
+    ASSERT(dnsResolverClass);
+    return dnsResolverClass;
 }
 
-void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueJava::platformResolve(const String& hostname)
 {
-    notImplemented();
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkPrefetch",
+            "(Ljava/lang/String;)V");
+    ASSERT(mid);
+
+    env->CallStaticVoidMethod(
+            GetDNSResolverClass(env),
+            mid,
+            (jstring) hostname.toJavaString(env));
+    if (WTF::CheckAndClearException(env)) {
+        // The prefetch was not sent out, nothing will report it done
+        decrementRequestCount();
+    }
 }
 
-void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
+void DNSResolveQueueJava::resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&& completionHandler)
 {
-    notImplemented();
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkResolve",
+            "(Ljava/lang/String;J)V");
+    ASSERT(mid);
+
+    m_pendingRequests.set(identifier, WTF::move(completionHandler));
+
+    env->CallStaticVoidMethod(
+            GetDNSResolverClass(env),
+            mid,
+            (jstring) hostname.toJavaString(env),
+            static_cast<jlong>(identifier));
+    if (WTF::CheckAndClearException(env)) {
+        didResolve(identifier, makeUnexpected(DNSError::Unknown));
+    }
+}
+
+void DNSResolveQueueJava::stopResolve(uint64_t identifier)
+{
+    auto completionHandler = m_pendingRequests.take(identifier);
+    if (!completionHandler) {
+        return;
+    }
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkCancel",
+            "(J)V");
+    ASSERT(mid);
+
+    env->CallStaticVoidMethod(
+            GetDNSResolverClass(env),
+            mid,
+            static_cast<jlong>(identifier));
+    WTF::CheckAndClearException(env);
+
+    completionHandler(makeUnexpected(DNSError::Cancelled));
 }
 
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkIsUsingProxy",
+            "()Z");
+    ASSERT(mid);
+
+    jboolean usingProxy = env->CallStaticBooleanMethod(GetDNSResolverClass(env), mid);
+    if (WTF::CheckAndClearException(env)) {
+        usingProxy = JNI_TRUE;
+    }
+    m_isUsingProxy = jbool_to_bool(usingProxy);
+}
+
+void DNSResolveQueueJava::didResolve(uint64_t identifier, DNSAddressesOrError&& result)
+{
+    // Requests that were stopped have already been answered
+    auto completionHandler = m_pendingRequests.take(identifier);
+    if (completionHandler) {
+        completionHandler(WTF::move(result));
+    }
+}
+
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_DNSResolver_twkDidPrefetch
+  (JNIEnv*, jclass)
+{
+    using namespace WebCore;
+    DNSResolveQueue::singleton().decrementRequestCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_DNSResolver_twkDidResolve
+  (JNIEnv* env, jclass, jlong identifier, jobjectArray addresses)
+{
+    using namespace WebCore;
+    auto& queue = static_cast<DNSResolveQueueJava&>(DNSResolveQueue::singleton());
+
+    if (!addresses) {
+        queue.didResolve(identifier, makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+
+    Vector<IPAddress> result;
+    jsize count = env->GetArrayLength(addresses);
+    for (jsize i = 0; i < count; i++) {
+        JLString address(static_cast<jstring>(env->GetObjectArrayElement(addresses, i)));
+        if (auto ipAddress = IPAddress::fromString(String(env, address))) {
+            result.append(WTF::move(*ipAddress));
+        }
+    }
+
+    if (result.isEmpty()) {
+        queue.didResolve(identifier, makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+    queue.didResolve(identifier, WTF::move(result));
 }
 
 }
@@ -26,7 +26,7 @@
 #pragma once
 
 #include "DNSResolveQueue.h"
-
+#include <wtf/HashMap.h>
 
 namespace WebCore {
 
@@ -39,6 +39,11 @@ public:
     void stopResolve(uint64_t identifier) final;
     void updateIsUsingProxy() override;
     void platformResolve(const String&) override;
+
+    void didResolve(uint64_t identifier, DNSAddressesOrError&&);
+
+private:
+    HashMap<uint64_t, DNSCompletionHandler> m_pendingRequests;
 };
 
 using DNSResolveQueuePlatform = DNSResolveQueueJava;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -299,11 +299,11 @@ void URLLoader::AsynchronousTarget::didReceiveResponse(
     }
 }
 
-void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int length)
+void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer& data, int length)
 {
     ResourceHandleClient* client = m_handle->client();
     if (client) {
-        client->didReceiveData(m_handle, *data, length);
+        client->didReceiveData(m_handle, data, length);
     }
 }
 
@@ -363,9 +363,9 @@ void URLLoader::SynchronousTarget::didReceiveResponse(
     m_response = response;
 }
 
-void URLLoader::SynchronousTarget::didReceiveData(const SharedBuffer* data, int length)
+void URLLoader::SynchronousTarget::didReceiveData(const SharedBuffer& data, int length)
 {
-    m_data.append(data->span());
+    m_data.append(data.span());
 }
 
 void URLLoader::SynchronousTarget::didFinishLoading()
@@ -508,9 +508,37 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<SharedBuffer> tmp_buf = SharedBuffer::create(std::span<const uint8_t>(address, remaining));
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    ASSERT(address);
+
+    // The Java buffer is reused as soon as this call returns, so this is the
+    // one copy of the bytes; the SharedBuffer is handed on to WebCore as is.
+    Ref<SharedBuffer> buffer = SharedBuffer::create(
+            std::span<const uint8_t>(address + position, remaining));
+    target->didReceiveData(buffer.get(), remaining);
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveBytes
+  (JNIEnv* env, jclass, jbyteArray bytes, jint offset, jint length,
+   jlong data)
+{
+    using namespace WebCore;
+    URLLoader::Target* target =
+            static_cast<URLLoader::Target*>(jlong_to_ptr(data));
+    ASSERT(target);
+
+    void* address = env->GetPrimitiveArrayCritical(bytes, nullptr);
+    if (!address) {
+        // The caller fails the load, the pending OutOfMemoryError
+        // would only escape on the event thread.
+        env->ExceptionClear();
+        return JNI_FALSE;
+    }
+    Ref<SharedBuffer> buffer = SharedBuffer::create(std::span<const uint8_t>(
+            static_cast<const uint8_t*>(address) + offset, length));
+    env->ReleasePrimitiveArrayCritical(bytes, address, JNI_ABORT);
+
+    target->didReceiveData(buffer.get(), length);
+    return JNI_TRUE;
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
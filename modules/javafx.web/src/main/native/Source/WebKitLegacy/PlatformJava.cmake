@@ -132,6 +132,7 @@ list(APPEND WebKitLegacy_SOURCES
     java/WebCoreSupport/BackForwardList.cpp
     java/WebCoreSupport/PageCacheJava.cpp
 
+    java/storage/IndexedDatabaseQuota.cpp
     java/storage/WebDatabaseProviderJava.cpp
 )
 
@@ -185,5 +186,6 @@ list(APPEND WebKitLegacy_INCLUDE_DIRECTORIES
     "${WebKitLegacy_DERIVED_SOURCES_DIR}"
     "${WEBKITLEGACY_DIR}/java/DOM"
     "${WEBKITLEGACY_DIR}/java/WebCoreSupport"
+    "${WEBKITLEGACY_DIR}/java/storage"
     "${WebCore_PRIVATE_FRAMEWORK_HEADERS_DIR}/WebCore"
 )
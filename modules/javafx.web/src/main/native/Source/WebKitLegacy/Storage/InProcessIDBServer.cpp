@@ -49,11 +49,11 @@ Ref<InProcessIDBServer> InProcessIDBServer::create(PAL::SessionID sessionID)
     return adoptRef(*new InProcessIDBServer(sessionID));
 }
 
-Ref<InProcessIDBServer> InProcessIDBServer::create(PAL::SessionID sessionID, const String& databaseDirectoryPath)
+Ref<InProcessIDBServer> InProcessIDBServer::create(PAL::SessionID sessionID, const String& databaseDirectoryPath, IDBServer::IDBServer::SpaceRequester&& spaceRequester)
 {
     ASSERT(!sessionID.isEphemeral());
 
-    return adoptRef(*new InProcessIDBServer(sessionID, databaseDirectoryPath));
+    return adoptRef(*new InProcessIDBServer(sessionID, databaseDirectoryPath, WTF::move(spaceRequester)));
 }
 
 InProcessIDBServer::~InProcessIDBServer()
@@ -70,19 +70,23 @@ InProcessIDBServer::~InProcessIDBServer()
     semaphore.wait();
 }
 
-InProcessIDBServer::InProcessIDBServer(PAL::SessionID sessionID, const String& databaseDirectoryPath)
+InProcessIDBServer::InProcessIDBServer(PAL::SessionID sessionID, const String& databaseDirectoryPath, IDBServer::IDBServer::SpaceRequester&& spaceRequester)
     : m_queue(WorkQueue::create("com.apple.WebKit.IndexedDBServer"_s))
 {
     ASSERT(isMainThread());
     m_connectionToServer = IDBClient::IDBConnectionToServer::create(*this, sessionID);
-    dispatchTask([this, protectedThis = Ref { *this }, directory = databaseDirectoryPath.isolatedCopy()] () mutable {
+    dispatchTask([this, protectedThis = Ref { *this }, directory = databaseDirectoryPath.isolatedCopy(), spaceRequester = WTF::move(spaceRequester)] () mutable {
         Ref connectionToClient = IDBServer::IDBConnectionToClient::create(*this);
         m_connectionToClient = connectionToClient.copyRef();
 
+        if (!spaceRequester) {
+            spaceRequester = [](const ClientOrigin&, uint64_t) {
+                return true;
+            };
+        }
+
         Locker locker { m_serverLock };
-        m_server = makeUnique<IDBServer::IDBServer>(directory, [](const ClientOrigin&, uint64_t) {
-            return true;
-        }, m_serverLock);
+        m_server = makeUnique<IDBServer::IDBServer>(directory, WTF::move(spaceRequester), m_serverLock);
         m_server->registerConnection(connectionToClient);
     });
 }
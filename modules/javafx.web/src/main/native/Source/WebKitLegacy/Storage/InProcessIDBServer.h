@@ -60,7 +60,7 @@ class InProcessIDBServer final : public WebCore::IDBClient::IDBConnectionToServe
     WTF_OVERRIDE_DELETE_FOR_CHECKED_PTR(InProcessIDBServer);
 public:
     static Ref<InProcessIDBServer> create(PAL::SessionID);
-    static Ref<InProcessIDBServer> create(PAL::SessionID, const String& databaseDirectoryPath);
+    static Ref<InProcessIDBServer> create(PAL::SessionID, const String& databaseDirectoryPath, WebCore::IDBServer::IDBServer::SpaceRequester&& = nullptr);
 
     virtual ~InProcessIDBServer();
 
@@ -133,7 +133,7 @@ public:
     void dispatchTaskReply(Function<void()>&&);
 
 private:
-    InProcessIDBServer(PAL::SessionID, const String& databaseDirectoryPath = nullString());
+    InProcessIDBServer(PAL::SessionID, const String& databaseDirectoryPath = nullString(), WebCore::IDBServer::IDBServer::SpaceRequester&& = nullptr);
 
     Lock m_serverLock;
     std::unique_ptr<WebCore::IDBServer::IDBServer> m_server;
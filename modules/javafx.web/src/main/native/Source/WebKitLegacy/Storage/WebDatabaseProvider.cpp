@@ -40,9 +40,15 @@ WebDatabaseProvider::~WebDatabaseProvider() = default;
 
 WebCore::IDBClient::IDBConnectionToServer& WebDatabaseProvider::idbConnectionToServerForSession(PAL::SessionID sessionID)
 {
+#if PLATFORM(JAVA)
+    return m_idbServerMap.ensure(sessionID, [this, &sessionID] {
+        return createIDBServer(sessionID);
+    }).iterator->value->connectionToServer();
+#else
     return m_idbServerMap.ensure(sessionID, [&sessionID] {
         return sessionID.isEphemeral() ? InProcessIDBServer::create(sessionID) : InProcessIDBServer::create(sessionID, indexedDatabaseDirectoryPath());
     }).iterator->value->connectionToServer();
+#endif
 }
 
 void WebDatabaseProvider::deleteAllDatabases()
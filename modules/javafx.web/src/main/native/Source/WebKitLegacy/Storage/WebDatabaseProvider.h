@@ -26,6 +26,9 @@
 #pragma once
 
 #include "InProcessIDBServer.h"
+#if PLATFORM(JAVA)
+#include "IndexedDatabaseQuota.h"
+#endif
 #include <WebCore/DatabaseProvider.h>
 #include <wtf/Forward.h>
 #include <wtf/HashMap.h>
@@ -35,16 +38,36 @@ class WebDatabaseProvider final : public WebCore::DatabaseProvider {
     friend class NeverDestroyed<WebDatabaseProvider>;
 public:
     static WebDatabaseProvider& singleton();
+#if PLATFORM(JAVA)
+    static Ref<WebDatabaseProvider> create();
+#endif
     virtual ~WebDatabaseProvider();
 
     WebCore::IDBClient::IDBConnectionToServer& idbConnectionToServerForSession(PAL::SessionID) override;
 
     void deleteAllDatabases();
 
+#if PLATFORM(JAVA)
+    // Returns false if the databases are kept in memory regardless.
+    bool setIndexedDatabaseDirectoryPath(const String&, uint64_t perOriginQuota);
+    // Usage of the origins that stored data in the directory since it was set.
+    Vector<IndexedDatabaseQuota::OriginUsage> indexedDatabaseUsage() const;
+    uint64_t indexedDatabasePerOriginQuota() const;
+#endif
+
 private:
     explicit WebDatabaseProvider();
 
+#if PLATFORM(JAVA)
+    Ref<InProcessIDBServer> createIDBServer(PAL::SessionID);
+#else
     static String indexedDatabaseDirectoryPath();
+#endif
 
     HashMap<PAL::SessionID, RefPtr<InProcessIDBServer>> m_idbServerMap;
+#if PLATFORM(JAVA)
+    String m_indexedDatabaseDirectoryPath;
+    uint64_t m_indexedDatabasePerOriginQuota { 0 };
+    RefPtr<IndexedDatabaseQuota> m_indexedDatabaseQuota;
+#endif
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,8 @@
 #include <WebCore/PageInspectorController.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/LogInitialization.h>
+#include <WebCore/MemoryPressureMonitorJava.h>
+#include <WebCore/MemoryRelease.h>
 #include <WebCore/NodeTraversal.h>
 #include <WebCore/Page.h>
 #include <WebCore/PageConfiguration.h>
@@ -256,6 +258,14 @@ RefPtr<RQRef> WebPage::jRenderTheme()
     return m_jRenderTheme;
 }
 
+ByteBufferPool& WebPage::renderBufferPool()
+{
+    if (!m_renderBufferPool) {
+        m_renderBufferPool = ByteBufferPool::create(RenderingQueue::DEFAULT_CAPACITY);
+    }
+    return *m_renderBufferPool;
+}
+
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
     if (m_rootLayer) {
@@ -273,7 +283,8 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     }
 
     // Will be deleted by GraphicsContext destructor
-    PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
+    PlatformContextJava* ppgc = new PlatformContextJava(rq, renderBufferPool(), jRenderTheme());
+    ppgc->setCullRect(IntRect(x, y, w, h));
     GraphicsContextJava gc(ppgc);
 
     // TODO: Following JS synchronization is not necessary for single thread model
@@ -297,7 +308,7 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
     }
 
     // Will be deleted by GraphicsContext destructor
-    PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
+    PlatformContextJava* ppgc = new PlatformContextJava(rq, renderBufferPool(), jRenderTheme());
     GraphicsContextJava gc(ppgc);
 
     if (m_rootLayer) {
@@ -924,6 +935,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
     });
 
+    MemoryPressureMonitorJava::install();
+
     JLObject jlself(self, true);
 
     //utaTODO: history agent implementation
@@ -936,7 +949,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     pc.editorClient = makeUniqueRef<EditorClientJava>(jlself);
     pc.dragClient = makeUnique<DragClientJava>(jlself);
     pc.inspectorBackendClient = makeUnique<InspectorClientJava>(jlself);
-    pc.databaseProvider = &WebDatabaseProvider::singleton();
+    pc.databaseProvider = WebDatabaseProvider::create();
     pc.storageNamespaceProvider = adoptRef(new WebStorageNamespaceProviderJava());
     pc.visitedLinkStore = VisitedLinkStoreJava::create();
 
@@ -1630,7 +1643,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPrint
     (JNIEnv* env, jobject self, jlong pPage, jobject rq, jint pageIndex, jfloat width)
 {
     auto webPage = WebPage::webPageFromJLong(pPage);
-    PlatformContextJava* ppgc = new PlatformContextJava(rq, webPage->jRenderTheme());
+    PlatformContextJava* ppgc = new PlatformContextJava(rq, webPage->renderBufferPool(), webPage->jRenderTheme());
     GraphicsContextJava gc(ppgc);
     webPage->print(gc, pageIndex, width);
 }
@@ -1700,6 +1713,23 @@ JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkGetVisibleRect
     return result;
 }
 
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetRenderBufferPoolStatistics
+    (JNIEnv* env, jobject, jlong pPage)
+{
+    ASSERT(pPage);
+    ByteBufferPool& pool = WebPage::webPageFromJLong(pPage)->renderBufferPool();
+
+    jlongArray result = env->NewLongArray(2);
+    WTF::CheckAndClearException(env);
+
+    jlong* arr = (jlong*)env->GetPrimitiveArrayCritical(result, nullptr);
+    arr[0] = pool.hitCount();
+    arr[1] = pool.missCount();
+    env->ReleasePrimitiveArrayCritical(result, arr, 0);
+
+    return result;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkScrollToPosition
     (JNIEnv* env, jobject self, jlong pFrame, jint x, jint y)
 {
@@ -2530,6 +2560,53 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageDatabasePat
         ->setLocalStorageDatabasePath(settings.localStorageDatabasePath());
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabaseDirectory
+  (JNIEnv* env, jobject, jlong pPage, jstring path, jlong perOriginQuota)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    return bool_to_jbool(static_cast<WebDatabaseProvider&>(page->databaseProvider())
+        .setIndexedDatabaseDirectoryPath(String(env, path),
+            perOriginQuota > 0 ? static_cast<uint64_t>(perOriginQuota) : 0));
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_WebPage_twkGetIndexedDatabaseUsage
+  (JNIEnv* env, jobject, jlong pPage)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    auto& provider = static_cast<WebDatabaseProvider&>(page->databaseProvider());
+    auto usage = provider.indexedDatabaseUsage();
+
+    static JGClass usageClass(env->FindClass("com/sun/webkit/IndexedDatabaseUsage"));
+    static jmethodID usageConstructor = env->GetMethodID(usageClass, "<init>",
+        "(Ljava/lang/String;Ljava/lang/String;JJIDI)V");
+    ASSERT(usageConstructor);
+
+    jobjectArray result = env->NewObjectArray(usage.size(), usageClass, nullptr);
+    if (WTF::CheckAndClearException(env))
+        return nullptr;
+
+    jlong quota = provider.indexedDatabasePerOriginQuota();
+    for (size_t i = 0; i < usage.size(); ++i) {
+        auto& originUsage = usage[i];
+        JLObject jusage(env->NewObject(usageClass, usageConstructor,
+            (jstring) originUsage.origin.clientOrigin.toString().toJavaString(env),
+            (jstring) originUsage.origin.topOrigin.toString().toJavaString(env),
+            static_cast<jlong>(originUsage.bytes),
+            quota,
+            static_cast<jint>(originUsage.scanCount),
+            static_cast<jdouble>(originUsage.scanTime.milliseconds()),
+            static_cast<jint>(originUsage.deniedRequests)));
+        if (WTF::CheckAndClearException(env))
+            return nullptr;
+        env->SetObjectArrayElement(result, i, jusage);
+    }
+    return result;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
   (JNIEnv*, jobject, jlong pPage, jboolean enabled)
 {
@@ -2540,6 +2617,42 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
     settings.setLocalStorageEnabled(jbool_to_bool(enabled));
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCacheDirectory
+  (JNIEnv* env, jobject, jlong pPage, jstring path)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    auto* pageSupplement = PageSupplementJava::from(page);
+    String directory(env, path);
+    if (directory.isEmpty()) {
+        pageSupplement->setBytecodeCache(nullptr);
+        return;
+    }
+    if (auto* bytecodeCache = pageSupplement->bytecodeCache(); bytecodeCache && bytecodeCache->directory() == directory)
+        return;
+    pageSupplement->setBytecodeCache(BytecodeCacheJava::create(directory));
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetBytecodeCacheStatistics
+  (JNIEnv* env, jobject, jlong pPage)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    auto* bytecodeCache = PageSupplementJava::from(page)->bytecodeCache();
+
+    jlongArray result = env->NewLongArray(2);
+    WTF::CheckAndClearException(env);
+
+    jlong* arr = (jlong*)env->GetPrimitiveArrayCritical(result, nullptr);
+    arr[0] = bytecodeCache ? bytecodeCache->hitCount() : 0;
+    arr[1] = bytecodeCache ? bytecodeCache->missCount() : 0;
+    env->ReleasePrimitiveArrayCritical(result, arr, 0);
+
+    return result;
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkGetDeveloperExtrasEnabled
   (JNIEnv *, jobject, jlong pPage)
 {
@@ -2627,4 +2740,10 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
     WebPage_doJSCGarbageCollection();
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkReleaseMemory
+  (JNIEnv*, jclass)
+{
+    WebCore::releaseMemory(Critical::Yes, Synchronous::Yes);
+}
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@
 
 namespace WebCore {
 
+class ByteBufferPool;
 class Frame;
 class GraphicsContext;
 class GraphicsLayer;
@@ -104,6 +105,7 @@ public:
     void disableWatchdog();
 
     RefPtr<RQRef> jRenderTheme();
+    ByteBufferPool& renderBufferPool();
 
 private:
     void requestJavaRepaint(const IntRect&);
@@ -132,6 +134,8 @@ private:
     RefPtr<Page> m_page;
     RefPtr<PrintContext> m_printContext;
     RefPtr<RQRef> m_jRenderTheme;
+    // Shared by the RenderingQueues created for painting this page.
+    RefPtr<ByteBufferPool> m_renderBufferPool;
 
     RefPtr<GraphicsLayer> m_rootLayer;
     std::unique_ptr<TextureMapper> m_textureMapper;
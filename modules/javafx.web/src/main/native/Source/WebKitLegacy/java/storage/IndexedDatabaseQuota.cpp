@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "IndexedDatabaseQuota.h"
+
+#include <WebCore/IDBServer.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+
+using namespace WebCore;
+
+// Quota used when the embedder does not configure one.
+static constexpr uint64_t defaultPerOriginQuota = 500 * 1024 * 1024;
+
+Ref<IndexedDatabaseQuota> IndexedDatabaseQuota::create(const String& directory, uint64_t perOriginQuota)
+{
+    return adoptRef(*new IndexedDatabaseQuota(directory, perOriginQuota));
+}
+
+IndexedDatabaseQuota::IndexedDatabaseQuota(const String& directory, uint64_t perOriginQuota)
+    : m_directory(directory.isolatedCopy())
+    , m_perOriginQuota(perOriginQuota ? perOriginQuota : defaultPerOriginQuota)
+{
+}
+
+bool IndexedDatabaseQuota::requestSpace(const ClientOrigin& origin, uint64_t size)
+{
+    ASSERT(!isMainThread());
+
+    Locker locker { m_lock };
+    auto& usage = m_usage.add(origin, OriginUsage { origin.isolatedCopy() }).iterator->value;
+    if (!usage.scanCount || usage.bytes + size > m_perOriginQuota)
+        scan(usage);
+
+    if (usage.bytes + size > m_perOriginQuota) {
+        usage.deniedRequests++;
+        return false;
+    }
+    usage.bytes += size;
+    return true;
+}
+
+void IndexedDatabaseQuota::scan(OriginUsage& usage)
+{
+    auto start = MonotonicTime::now();
+    usage.bytes = IDBServer::IDBServer::diskUsage(m_directory, usage.origin);
+    usage.scanCount++;
+    usage.scanTime += MonotonicTime::now() - start;
+}
+
+auto IndexedDatabaseQuota::usage() const -> Vector<OriginUsage>
+{
+    Locker locker { m_lock };
+    Vector<OriginUsage> result;
+    result.reserveInitialCapacity(m_usage.size());
+    for (auto& usage : m_usage.values()) {
+        result.append(usage);
+        result.last().origin = usage.origin.isolatedCopy();
+    }
+    return result;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/ClientOrigin.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/Seconds.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+// Enforces the per-origin quota of one IndexedDB directory. Space requests
+// arrive on the IDB server work queue, where the databases are also read and
+// written, so an origin's directory is only scanned there: on its first
+// request and whenever the running estimate would exceed the quota.
+class IndexedDatabaseQuota : public ThreadSafeRefCounted<IndexedDatabaseQuota> {
+public:
+    static Ref<IndexedDatabaseQuota> create(const String& directory, uint64_t perOriginQuota);
+
+    bool requestSpace(const WebCore::ClientOrigin&, uint64_t size);
+
+    struct OriginUsage {
+        WebCore::ClientOrigin origin;
+        // Scanned size plus the space granted since.
+        uint64_t bytes { 0 };
+        unsigned scanCount { 0 };
+        Seconds scanTime;
+        unsigned deniedRequests { 0 };
+    };
+    // Usage of every origin that requested space, safe to call on any thread.
+    Vector<OriginUsage> usage() const;
+
+    uint64_t perOriginQuota() const { return m_perOriginQuota; }
+
+private:
+    IndexedDatabaseQuota(const String& directory, uint64_t perOriginQuota);
+
+    void scan(OriginUsage&) WTF_REQUIRES_LOCK(m_lock);
+
+    const String m_directory;
+    const uint64_t m_perOriginQuota;
+    mutable Lock m_lock;
+    HashMap<WebCore::ClientOrigin, OriginUsage> m_usage WTF_GUARDED_BY_LOCK(m_lock);
+};
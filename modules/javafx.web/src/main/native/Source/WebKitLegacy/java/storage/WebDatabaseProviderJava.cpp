@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,57 @@
 
 #include "WebDatabaseProvider.h"
 
-String WebDatabaseProvider::indexedDatabaseDirectoryPath()
+#include "IndexedDatabaseQuota.h"
+#include <wtf/MainThread.h>
+
+Ref<WebDatabaseProvider> WebDatabaseProvider::create()
+{
+    return adoptRef(*new WebDatabaseProvider);
+}
+
+Ref<InProcessIDBServer> WebDatabaseProvider::createIDBServer(PAL::SessionID sessionID)
+{
+    if (sessionID.isEphemeral())
+        return InProcessIDBServer::create(sessionID);
+
+    // Without a directory the databases are kept in memory.
+    if (m_indexedDatabaseDirectoryPath.isEmpty())
+        return InProcessIDBServer::create(sessionID, emptyString());
+
+    if (!m_indexedDatabaseQuota)
+        m_indexedDatabaseQuota = IndexedDatabaseQuota::create(m_indexedDatabaseDirectoryPath, m_indexedDatabasePerOriginQuota);
+    return InProcessIDBServer::create(sessionID, m_indexedDatabaseDirectoryPath,
+        [quota = Ref { *m_indexedDatabaseQuota }](const WebCore::ClientOrigin& origin, uint64_t size) {
+            return quota->requestSpace(origin, size);
+        });
+}
+
+bool WebDatabaseProvider::setIndexedDatabaseDirectoryPath(const String& path, uint64_t perOriginQuota)
+{
+    ASSERT(isMainThread());
+    // Servers that are already open keep their directory and quota.
+    m_indexedDatabaseQuota = nullptr;
+    m_indexedDatabasePerOriginQuota = perOriginQuota;
+#if OS(LINUX)
+    m_indexedDatabaseDirectoryPath = path;
+    return true;
+#else
+    // FileSystemJava can not yet list, move or delete files on this
+    // platform, so the SQLite backing store could not remove a database
+    // or measure its size. Keep the databases in memory instead.
+    UNUSED_PARAM(path);
+    return false;
+#endif
+}
+
+Vector<IndexedDatabaseQuota::OriginUsage> WebDatabaseProvider::indexedDatabaseUsage() const
+{
+    if (!m_indexedDatabaseQuota)
+        return { };
+    return m_indexedDatabaseQuota->usage();
+}
+
+uint64_t WebDatabaseProvider::indexedDatabasePerOriginQuota() const
 {
-    return ""_s;
+    return m_indexedDatabaseQuota ? m_indexedDatabaseQuota->perOriginQuota() : 0;
 }
@@ -111,6 +111,11 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_MEDIA_SESSION PRIVATE ON)
 
 if (APPLE)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE OFF)
+elseif (WTF_OS_LINUX AND (WTF_CPU_X86_64 OR WTF_CPU_ARM64))
+# libpas is only supported on 64-bit Linux. Gigacage turns itself off when
+# the address space reservation fails (strict overcommit, ulimit -v on the
+# JVM) and can be disabled with GIGACAGE_ENABLED=0.
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE OFF)
 else()
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE ON)
 endif()
@@ -153,6 +158,7 @@ set(JavaScriptCore_LIBRARY_TYPE STATIC)
 set(WebCore_LIBRARY_TYPE STATIC)
 set(WebCoreTestSupport_LIBRARY_TYPE STATIC)
 set(PAL_LIBRARY_TYPE STATIC)
+set(bmalloc_LIBRARY_TYPE STATIC)
 
 
 if (CMAKE_MAJOR_VERSION LESS 3)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,10 @@ public class WebPageShim {
         return page.test_getFramesCount();
     }
 
+    public static void releaseMemory() {
+        WebPage.test_releaseMemory();
+    }
+
     private static WCGraphicsContext setupPageWithGraphics(WebPage page, int x, int y, int w, int h) {
         page.setBounds(x, y, w, h);
         // forces layout and renders the page into RenderQueue.
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.network;
+
+import com.sun.webkit.network.DNSResolverShim;
+import java.net.InetAddress;
+import java.net.UnknownHostException;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertSame;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+/**
+ * Tests the DNS resolver against a stub resolver.
+ */
+public class DNSResolverTest {
+
+    private static final InetAddress[] ADDRESSES = addresses();
+
+    private static InetAddress[] addresses() {
+        try {
+            return new InetAddress[] {
+                InetAddress.getByAddress("stub.test", new byte[] {10, 0, 0, 1}),
+                InetAddress.getByAddress("stub.test", new byte[] {10, 0, 0, 2})
+            };
+        } catch (UnknownHostException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    @AfterEach
+    public void tearDown() {
+        DNSResolverShim.setResolver(null);
+    }
+
+    /**
+     * Tests that concurrent lookups of a host share one resolution.
+     */
+    @Test
+    public void testDuplicateLookupsAreCoalesced() throws Exception {
+        AtomicInteger calls = new AtomicInteger();
+        CountDownLatch release = new CountDownLatch(1);
+        DNSResolverShim.setResolver(host -> {
+            calls.incrementAndGet();
+            try {
+                release.await(5, TimeUnit.SECONDS);
+            } catch (InterruptedException ex) {
+                throw new UnknownHostException(host);
+            }
+            return ADDRESSES;
+        });
+
+        CompletableFuture<InetAddress[]> first = DNSResolverShim.lookup("stub.test");
+        CompletableFuture<InetAddress[]> second = DNSResolverShim.lookup("stub.test");
+        assertSame(first, second);
+
+        release.countDown();
+        assertArrayEquals(ADDRESSES, first.get(5, TimeUnit.SECONDS));
+        assertEquals(1, calls.get());
+    }
+
+    /**
+     * Tests that a host is resolved again once its lookup has finished.
+     */
+    @Test
+    public void testFinishedLookupIsNotKept() throws Exception {
+        AtomicInteger calls = new AtomicInteger();
+        DNSResolverShim.setResolver(host -> {
+            calls.incrementAndGet();
+            return ADDRESSES;
+        });
+
+        DNSResolverShim.lookup("stub.test").get(5, TimeUnit.SECONDS);
+        // The finished lookup is removed right after it completes
+        for (int i = 0; i < 100 && calls.get() < 2; i++) {
+            DNSResolverShim.lookup("stub.test").get(5, TimeUnit.SECONDS);
+            Thread.sleep(10);
+        }
+        assertTrue(calls.get() >= 2);
+    }
+
+    /**
+     * Tests that different hosts are resolved separately.
+     */
+    @Test
+    public void testDifferentHosts() throws Exception {
+        DNSResolverShim.setResolver(host -> new InetAddress[] {
+            InetAddress.getByAddress(host, new byte[] {127, 0, 0, (byte) host.length()})
+        });
+
+        InetAddress[] a = DNSResolverShim.lookup("a.test").get(5, TimeUnit.SECONDS);
+        InetAddress[] b = DNSResolverShim.lookup("bb.test").get(5, TimeUnit.SECONDS);
+        assertEquals("a.test", a[0].getHostName());
+        assertEquals("bb.test", b[0].getHostName());
+    }
+
+    /**
+     * Tests that a failed resolution fails the lookup.
+     */
+    @Test
+    public void testFailedLookup() {
+        DNSResolverShim.setResolver(host -> {
+            throw new UnknownHostException(host);
+        });
+
+        ExecutionException ex = assertThrows(ExecutionException.class,
+                () -> DNSResolverShim.lookup("missing.test").get(5, TimeUnit.SECONDS));
+        assertTrue(ex.getCause() instanceof UnknownHostException);
+    }
+}
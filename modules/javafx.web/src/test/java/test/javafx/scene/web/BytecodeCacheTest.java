@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.sun.javafx.PlatformUtil;
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.CountDownLatch;
+import javafx.beans.value.ChangeListener;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+public class BytecodeCacheTest extends TestBase {
+
+    private Path dir;
+    private WebEngine webEngine;
+
+    @BeforeEach
+    public void before() throws IOException {
+        dir = Files.createTempDirectory("bytecodecache-test");
+        webEngine = submit(() -> new WebEngine());
+    }
+
+    @AfterEach
+    public void after() throws IOException {
+        submit(() -> {
+            WebEngineShim.dispose(webEngine);
+        });
+        deleteRecursively(dir.toFile());
+    }
+
+    @Test
+    public void testBytecodeCacheEntryIsWrittenAndHit() throws IOException {
+        // The file system calls the cache relies on are only implemented
+        // on Linux.
+        assumeTrue(PlatformUtil.isLinux());
+
+        Files.writeString(dir.resolve("script.js"),
+                "function multiply(a, b) { return a * b; }\n"
+                + "var answer = multiply(6, 7);\n");
+        final File html = dir.resolve("page.html").toFile();
+        Files.writeString(html.toPath(),
+                "<html><body><script src='script.js'></script></body></html>");
+        final File cacheDir = new File(dir.toFile(), "userdata/bytecodecache");
+
+        final WebPage page = WebEngineShim.getPage(webEngine);
+        submit(() -> {
+            webEngine.setUserDataDirectory(new File(dir.toFile(), "userdata"));
+            webEngine.setBytecodeCacheEnabled(true);
+        });
+
+        load(webEngine, html);
+        submit(() -> {
+            assertEquals(42, webEngine.executeScript("answer"));
+            long[] stats = page.getBytecodeCacheStatistics();
+            assertEquals(2, stats.length);
+            assertEquals(0, stats[0]);
+            assertEquals(1, stats[1]);
+        });
+
+        // Navigating away writes the bytecode of the page's scripts.
+        loadContent(webEngine, "");
+        File[] entries = cacheDir.listFiles((d, name) -> name.endsWith(".bytecode-cache"));
+        assertTrue(entries != null && entries.length == 1,
+                "Expected one bytecode cache entry in " + cacheDir);
+        assertTrue(entries[0].length() > 0, "Expected a non-empty bytecode cache entry");
+
+        // Drop the bytecode JSC still holds in memory, so that the reload
+        // has to go to the cache entry.
+        submit(() -> {
+            WebPageShim.releaseMemory();
+        });
+
+        load(webEngine, html);
+        submit(() -> {
+            assertEquals(42, webEngine.executeScript("answer"));
+            long[] stats = page.getBytecodeCacheStatistics();
+            assertEquals(1, stats[0]);
+            assertEquals(1, stats[1]);
+        });
+    }
+
+    private void load(WebEngine webEngine, File file) {
+        executeLoadJob(webEngine, () -> {
+            webEngine.load(file.toURI().toASCIIString());
+        });
+    }
+
+    private void loadContent(WebEngine webEngine, String content) {
+        executeLoadJob(webEngine, () -> {
+            webEngine.loadContent(content);
+        });
+    }
+
+    private void executeLoadJob(WebEngine webEngine, Runnable job) {
+        final CountDownLatch latch = new CountDownLatch(1);
+        submit(() -> {
+            webEngine.getLoadWorker().runningProperty().addListener(
+                    (ChangeListener<Boolean>) (ov, oldValue, newValue) -> {
+                        if (!newValue) {
+                            latch.countDown();
+                        }
+                    });
+            job.run();
+        });
+        try {
+            latch.await();
+        } catch (InterruptedException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    private static void deleteRecursively(File file) {
+        File[] files = file.listFiles();
+        if (files != null) {
+            for (File f : files) {
+                deleteRecursively(f);
+            }
+        }
+        if (!file.delete()) {
+            file.deleteOnExit();
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -119,6 +119,34 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasPrimitivesNearBounds() {
+        final String htmlCanvasContent =
+                "<canvas id='canvas' width='100' height='100'></canvas> <script>" +
+                        "var ctx = document.getElementById('canvas').getContext('2d');" +
+                        // Entirely outside of the canvas, not painted.
+                        "ctx.fillStyle = 'blue';" +
+                        "ctx.fillRect(200, 200, 50, 50);" +
+                        // Outside of the canvas before the translation is applied.
+                        "ctx.save();" +
+                        "ctx.translate(-200, 0);" +
+                        "ctx.fillStyle = 'red';" +
+                        "ctx.fillRect(210, 10, 20, 20);" +
+                        "ctx.restore();" +
+                        // Only the stroke reaches into the canvas.
+                        "ctx.lineWidth = 20;" +
+                        "ctx.strokeStyle = 'green';" +
+                        "ctx.strokeRect(-50, 60, 48, 30);" +
+                        "</script>";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final String getPixel = "document.getElementById('canvas').getContext('2d').getImageData(%d, %d, 1, 1).data[%d]";
+            assertEquals(255, (int) getEngine().executeScript(String.format(getPixel, 20, 20, 0)), "Translated rect should be painted");
+            assertEquals(128, (int) getEngine().executeScript(String.format(getPixel, 3, 75, 1)), "Stroke should be painted");
+            assertEquals(0, (int) getEngine().executeScript(String.format(getPixel, 99, 99, 3)), "Nothing should be painted");
+        });
+    }
+
     // JDK-8234471
     @Test public void testCanvasPattern() throws Exception {
         final String htmlCanvasContent = "\n"
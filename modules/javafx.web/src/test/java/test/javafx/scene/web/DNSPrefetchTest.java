@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import com.sun.webkit.network.DNSResolverShim;
+import java.net.InetAddress;
+import java.net.ProxySelector;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.function.BooleanSupplier;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Tests DNS prefetching through WebCore's resolve queue, the native
+ * callbacks into DNSResolver and the replies back into WebCore.
+ */
+public class DNSPrefetchTest extends TestBase {
+
+    // WebCore resolves up to this many names right away and caps the
+    // names in flight at twice as many.
+    private static final int NAMES_TO_RESOLVE_IMMEDIATELY = 4;
+    private static final int ROUNDS = 3;
+
+    private final Set<String> resolvedHosts = ConcurrentHashMap.newKeySet();
+    private ProxySelector proxySelector;
+
+    @BeforeEach
+    public void before() {
+        // Prefetching is off behind a proxy
+        proxySelector = ProxySelector.getDefault();
+        ProxySelector.setDefault(ProxySelector.of(null));
+        DNSResolverShim.setResolver(host -> {
+            resolvedHosts.add(host);
+            return new InetAddress[] {
+                InetAddress.getByAddress(host, new byte[] {10, 0, 0, 1})
+            };
+        });
+    }
+
+    @AfterEach
+    public void after() {
+        DNSResolverShim.setResolver(null);
+        ProxySelector.setDefault(proxySelector);
+    }
+
+    /**
+     * Tests that each prefetch is reported done to WebCore. Otherwise the
+     * names in flight pile up and later rounds are never sent out.
+     */
+    @Test
+    public void testPrefetchesAreReportedDone() throws InterruptedException {
+        for (int round = 0; round < ROUNDS; round++) {
+            StringBuilder html = new StringBuilder("<html><head>");
+            for (int i = 0; i < NAMES_TO_RESOLVE_IMMEDIATELY; i++) {
+                html.append("<link rel='dns-prefetch' href='http://")
+                    .append(host(round, i)).append("/'>");
+            }
+            html.append("</head><body></body></html>");
+            loadContent(html.toString());
+
+            final int r = round;
+            assertTrue(waitFor(() -> {
+                for (int i = 0; i < NAMES_TO_RESOLVE_IMMEDIATELY; i++) {
+                    if (!resolvedHosts.contains(host(r, i))) {
+                        return false;
+                    }
+                }
+                return true;
+            }), "Round " + round + " was not prefetched: " + resolvedHosts);
+
+            // The replies are posted to the event thread after the lookups
+            // complete, let them through before the next round.
+            Thread.sleep(100);
+            submit(() -> { });
+        }
+    }
+
+    private static String host(int round, int index) {
+        return "prefetch-" + round + "-" + index + ".test";
+    }
+
+    private static boolean waitFor(BooleanSupplier condition)
+            throws InterruptedException {
+        // Names beyond the immediate ones are sent after a one second delay
+        for (int i = 0; i < 50 && !condition.getAsBoolean(); i++) {
+            Thread.sleep(100);
+        }
+        return condition.getAsBoolean();
+    }
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.sun.javafx.PlatformUtil;
+import com.sun.webkit.IndexedDatabaseUsage;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.CountDownLatch;
+import java.util.stream.Stream;
+import javafx.beans.value.ChangeListener;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+public class IndexedDBTest extends TestBase {
+
+    private static final String QUOTA_PROPERTY = "com.sun.webkit.indexedDBQuota";
+    private static final int QUOTA = 1024 * 1024;
+
+    private static final String SCRIPT =
+            "var result = null;\n"
+            + "function run(promise) {\n"
+            + "    result = null;\n"
+            + "    promise.then(r => { result = String(r); },\n"
+            + "                 e => { result = 'error:' + (e && e.name); });\n"
+            + "}\n"
+            + "function openStore(name) {\n"
+            + "    return new Promise((resolve, reject) => {\n"
+            + "        var request = indexedDB.open(name, 1);\n"
+            + "        request.onupgradeneeded = () => request.result.createObjectStore('store');\n"
+            + "        request.onsuccess = () => resolve(request.result);\n"
+            + "        request.onerror = () => reject(request.error);\n"
+            + "    });\n"
+            + "}\n"
+            + "function put(name, size) {\n"
+            + "    return openStore(name).then(db => new Promise((resolve, reject) => {\n"
+            + "        var tx = db.transaction('store', 'readwrite');\n"
+            + "        tx.objectStore('store').put('x'.repeat(size), 1);\n"
+            + "        tx.oncomplete = () => { db.close(); resolve('ok'); };\n"
+            + "        tx.onabort = () => { db.close(); reject(tx.error); };\n"
+            + "    }));\n"
+            + "}\n"
+            + "function get(name) {\n"
+            + "    return openStore(name).then(db => new Promise((resolve, reject) => {\n"
+            + "        var request = db.transaction('store').objectStore('store').get(1);\n"
+            + "        request.onsuccess = () => { db.close(); resolve(request.result); };\n"
+            + "        request.onerror = () => { db.close(); reject(request.error); };\n"
+            + "    }));\n"
+            + "}\n"
+            + "function deleteDatabase(name) {\n"
+            + "    return new Promise((resolve, reject) => {\n"
+            + "        var request = indexedDB.deleteDatabase(name);\n"
+            + "        request.onsuccess = () => resolve('ok');\n"
+            + "        request.onerror = () => reject(request.error);\n"
+            + "    });\n"
+            + "}\n"
+            + "function names() {\n"
+            + "    return indexedDB.databases().then(list => list.map(d => d.name).sort().join(','));\n"
+            + "}\n";
+
+    private Path dir;
+    private WebEngine webEngine;
+
+    @BeforeEach
+    public void before() throws IOException {
+        dir = Files.createTempDirectory("indexeddb-test");
+        Files.writeString(dir.resolve("page.html"),
+                "<html><body><script>" + SCRIPT + "</script></body></html>");
+        System.setProperty(QUOTA_PROPERTY, Integer.toString(QUOTA));
+        webEngine = submit(() -> new WebEngine());
+        submit(() -> {
+            webEngine.setUserDataDirectory(dir.resolve("userdata").toFile());
+        });
+    }
+
+    @AfterEach
+    public void after() {
+        submit(() -> {
+            WebEngineShim.dispose(webEngine);
+        });
+        System.clearProperty(QUOTA_PROPERTY);
+        deleteRecursively(dir.toFile());
+    }
+
+    @Test
+    public void testDeleteDatabaseRemovesFiles() throws Exception {
+        // Databases are only stored on disk on Linux.
+        assumeTrue(PlatformUtil.isLinux());
+        load(webEngine, dir.resolve("page.html").toFile());
+
+        assertEquals("ok", run("put('first', 16)"));
+        assertEquals("ok", run("put('second', 16)"));
+        assertEquals("first,second", run("names()"));
+        assertEquals(2, databaseFileCount());
+
+        assertEquals("ok", run("deleteDatabase('first')"));
+        assertEquals("second", run("names()"));
+        assertEquals(1, databaseFileCount());
+    }
+
+    @Test
+    public void testWriteBeyondQuotaFails() throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+        load(webEngine, dir.resolve("page.html").toFile());
+
+        assertEquals("ok", run("put('small', 64 * 1024)"));
+        assertEquals("error:QuotaExceededError", run("put('large', " + 2 * QUOTA + ")"));
+
+        // Deleting a database frees its space again.
+        assertEquals("ok", run("deleteDatabase('small')"));
+        assertEquals("ok", run("put('medium', " + QUOTA / 2 + ")"));
+
+        IndexedDatabaseUsage[] usage = submit(() -> WebEngineShim.getPage(webEngine).getIndexedDatabaseUsage());
+        assertEquals(1, usage.length);
+        assertTrue(usage[0].origin().startsWith("file:"), usage[0].origin());
+        assertEquals(QUOTA, usage[0].quota());
+        assertTrue(usage[0].bytes() > 0, "bytes: " + usage[0].bytes());
+        // The first request and the denied one scan the directory.
+        assertTrue(usage[0].scanCount() >= 2, "scans: " + usage[0].scanCount());
+        assertTrue(usage[0].deniedRequests() >= 1, "denied: " + usage[0].deniedRequests());
+    }
+
+    @Test
+    public void testPersistenceIsReported() {
+        load(webEngine, dir.resolve("page.html").toFile());
+        boolean persistent = submit(() -> WebEngineShim.getPage(webEngine).isIndexedDatabasePersistent());
+        assertEquals(PlatformUtil.isLinux(), persistent);
+    }
+
+    @Test
+    public void testDataSurvivesNewWebEngine() throws Exception {
+        assumeTrue(PlatformUtil.isLinux());
+        load(webEngine, dir.resolve("page.html").toFile());
+        assertEquals("ok", run("put('kept', 1000)"));
+
+        // A new engine on the same user data directory sees the database.
+        submit(() -> {
+            WebEngineShim.dispose(webEngine);
+        });
+        webEngine = submit(() -> new WebEngine());
+        submit(() -> {
+            webEngine.setUserDataDirectory(dir.resolve("userdata").toFile());
+        });
+        load(webEngine, dir.resolve("page.html").toFile());
+        assertEquals("kept", run("names()"));
+        assertEquals("x".repeat(1000), run("get('kept')"));
+    }
+
+    private String run(String call) throws InterruptedException {
+        submit(() -> {
+            webEngine.executeScript("run(" + call + ")");
+        });
+        String result = null;
+        for (int i = 0; i < 100 && result == null; i++) {
+            Thread.sleep(100);
+            result = submit(() -> (String) webEngine.executeScript("result"));
+        }
+        assertNotNull(result, call + " did not complete");
+        return result;
+    }
+
+    private long databaseFileCount() throws IOException {
+        try (Stream<Path> files = Files.walk(dir.resolve("userdata/indexeddb"))) {
+            return files.filter(f -> f.getFileName().toString().equals("IndexedDB.sqlite3"))
+                    .count();
+        }
+    }
+
+    private void load(WebEngine webEngine, File file) {
+        final CountDownLatch latch = new CountDownLatch(1);
+        submit(() -> {
+            webEngine.getLoadWorker().runningProperty().addListener(
+                    (ChangeListener<Boolean>) (ov, oldValue, newValue) -> {
+                        if (!newValue) {
+                            latch.countDown();
+                        }
+                    });
+            webEngine.load(file.toURI().toASCIIString());
+        });
+        try {
+            latch.await();
+        } catch (InterruptedException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    private static void deleteRecursively(File file) {
+        File[] files = file.listFiles();
+        if (files != null) {
+            for (File f : files) {
+                deleteRecursively(f);
+            }
+        }
+        if (!file.delete()) {
+            file.deleteOnExit();
+        }
+    }
+}
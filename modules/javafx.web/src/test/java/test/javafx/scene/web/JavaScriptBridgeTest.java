@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -389,6 +389,55 @@ public class JavaScriptBridgeTest extends TestBase {
         });
     }
 
+    public static class Counter {
+        public int count;
+
+        public int add(int delta) {
+            count += delta;
+            return count;
+        }
+
+        public long addLong(long delta) {
+            count += (int) delta;
+            return count;
+        }
+
+        public double half(double value) {
+            return value / 2;
+        }
+
+        public boolean isEven(int value) {
+            return value % 2 == 0;
+        }
+
+        public String concat(String a, String b) {
+            return a + b;
+        }
+    }
+
+    public @Test void testRepeatedMethodCalls() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            Counter counter = new Counter();
+            bind("counter", counter);
+            // The resolved methods are reused across calls, the results
+            // must not depend on which call resolved them.
+            Object result = web.executeScript(
+                    "var s = 0, e = 0, h = 0, c = '';" +
+                    "for (var i = 0; i < 10000; i++) {" +
+                    "  s = counter.add(1);" +
+                    "  s = counter.addLong(1);" +
+                    "  h += counter.half(i);" +
+                    "  if (counter.isEven(i)) e++;" +
+                    "  c = counter.concat('a', String(i));" +
+                    "}" +
+                    "[s, e, h, c].join();");
+            assertEquals(20000, counter.count);
+            assertEquals("20000,5000,24997500,a9999", result);
+        });
+    }
+
     // JDK-8089842
     public static class CharMember {
         public char c;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2022, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,13 +28,16 @@ package test.javafx.scene.web;
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertTrue;
 import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
 
 import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.AfterAll;
 import org.junit.jupiter.api.BeforeAll;
 import org.junit.jupiter.api.Test;
+import com.sun.javafx.PlatformUtil;
 import java.io.File;
 import java.io.IOException;
+import java.util.function.BooleanSupplier;
 import javafx.scene.web.WebView;
 import javafx.scene.web.WebEngine;
 
@@ -56,6 +59,20 @@ public class LocalStorageTest extends TestBase {
         }
     }
 
+    private static File[] localStorageFiles() {
+        File[] files = new File(LOCAL_STORAGE_DIR, "localstorage")
+                .listFiles((dir, name) -> name.endsWith(".localstorage"));
+        return files == null ? new File[0] : files;
+    }
+
+    // Local storage is written to disk by a timer, wait for it to run.
+    private static boolean waitFor(BooleanSupplier condition) throws InterruptedException {
+        for (int i = 0; i < 100 && !condition.getAsBoolean(); i++) {
+            Thread.sleep(100);
+        }
+        return condition.getAsBoolean();
+    }
+
     private WebEngine createWebEngine() {
         return submit(() -> new WebEngine());
     }
@@ -140,4 +157,26 @@ public class LocalStorageTest extends TestBase {
             assertTrue(res);
         });
     }
+
+    /* test that the database file is deleted once the storage is emptied */
+    @Test
+    public void testLocalStorageClearDeletesDatabaseFile() throws Exception {
+        // The files are only deleted by the native FileSystem on Linux.
+        assumeTrue(PlatformUtil.isLinux());
+        final WebEngine webEngine = getEngine();
+        webEngine.setJavaScriptEnabled(true);
+        webEngine.setUserDataDirectory(LOCAL_STORAGE_DIR);
+        load(new File("src/test/resources/test/html/localstorage.html"));
+        submit(() -> {
+            getView().getEngine().executeScript("test_local_storage_set();");
+        });
+        assertTrue(waitFor(() -> localStorageFiles().length > 0),
+                "local storage database file was not written");
+
+        submit(() -> {
+            getView().getEngine().executeScript("delete_items();");
+        });
+        assertTrue(waitFor(() -> localStorageFiles().length == 0),
+                "local storage database file was not deleted");
+    }
 }
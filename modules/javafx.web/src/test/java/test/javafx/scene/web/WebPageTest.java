@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@ import javafx.scene.web.WebEngineShim;
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertNull;
 import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
 import org.junit.jupiter.api.Test;
 
 public class WebPageTest extends TestBase {
@@ -105,4 +106,25 @@ public class WebPageTest extends TestBase {
             page.getClientLocationOffset(0, 0);
         });
     }
+
+    @Test
+    public void testRenderBufferPoolReusesBuffers() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent(HTML);
+
+        submit(() -> {
+            WebPageShim.paint(page, 0, 0, 800, 600);
+            // Disposing the render frames sends the buffers back to the pool.
+            page.dropRenderFrames();
+        });
+        submit(() -> {
+            WebPageShim.paint(page, 0, 0, 800, 600);
+        });
+        submit(() -> {
+            long[] stats = page.getRenderBufferPoolStatistics();
+            assertEquals(2, stats.length);
+            assertTrue(stats[1] > 0, "Expected buffers to be allocated: " + stats[1]);
+            assertTrue(stats[0] > 0, "Expected buffers to be reused: " + stats[0]);
+        });
+    }
 }
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.robot.com.sun.glass.ui.gtk;
+
+import java.io.BufferedOutputStream;
+import java.io.DataOutputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.image.PixelReader;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.CycleMethod;
+import javafx.scene.paint.LinearGradient;
+import javafx.scene.paint.RadialGradient;
+import javafx.scene.paint.Stop;
+import javafx.scene.robot.Robot;
+import javafx.scene.shape.Circle;
+import javafx.scene.shape.Rectangle;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+import javafx.stage.Stage;
+import javafx.stage.StageStyle;
+import javafx.stage.WindowEvent;
+
+/*
+ * Test application launched by ShmPresenterTest, once with MIT-SHM presenting
+ * enabled and once with -Dglass.disableShm=true.
+ * Test steps:
+ * 1. Show an undecorated stage with a fixed scene.
+ * 2. Update parts of the scene twice, so both SHM images get partial
+ *    updates on top of an older frame.
+ * 3. Capture the stage from the screen and write the pixels to the file
+ *    given as first argument.
+ */
+public class ShmPresenterApp {
+
+    // Error exit codes. Note that 0 and 1 are reserved for normal exit and
+    // failure to launch java, respectively
+    public static final int ERROR_NONE = 2;
+    public static final int ERROR_LAUNCH = 3;
+    public static final int ERROR_CAPTURE = 4;
+
+    public static final int X = 100;
+    public static final int Y = 100;
+    public static final int WIDTH = 320;
+    public static final int HEIGHT = 240;
+
+    static final CountDownLatch startupLatch = new CountDownLatch(1);
+    static volatile Rectangle moving;
+    static volatile Circle fading;
+
+    public static class TestApp extends Application {
+        @Override
+        public void start(Stage stage) {
+            Rectangle background = new Rectangle(WIDTH, HEIGHT,
+                    new LinearGradient(0, 0, 1, 1, true, CycleMethod.NO_CYCLE,
+                            new Stop(0, Color.web("#204080")), new Stop(1, Color.web("#e0c040"))));
+
+            moving = new Rectangle(20, 20, 90, 60);
+            moving.setFill(Color.rgb(200, 30, 30, 0.6));
+            moving.setRotate(15);
+
+            fading = new Circle(230, 150, 60,
+                    new RadialGradient(0, 0, 0.5, 0.5, 0.5, true, CycleMethod.NO_CYCLE,
+                            new Stop(0, Color.WHITE), new Stop(1, Color.rgb(30, 160, 60, 0.3))));
+
+            Text text = new Text(20, 210, "MIT-SHM");
+            text.setFont(Font.font(28));
+            text.setFill(Color.BLACK);
+
+            Scene scene = new Scene(new Group(background, moving, fading, text), WIDTH, HEIGHT);
+            stage.initStyle(StageStyle.UNDECORATED);
+            stage.setScene(scene);
+            stage.setX(X);
+            stage.setY(Y);
+            stage.setAlwaysOnTop(true);
+            stage.addEventHandler(WindowEvent.WINDOW_SHOWN, e ->
+                    Platform.runLater(startupLatch::countDown));
+            stage.show();
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        String output = args[0];
+
+        new Thread(() -> Application.launch(TestApp.class, (String[])null)).start();
+        waitForLatch(startupLatch, 10, ERROR_LAUNCH);
+        Thread.sleep(1000);
+
+        // 2. Each update only damages part of the window
+        runAndWait(() -> moving.setTranslateX(60));
+        Thread.sleep(250);
+        runAndWait(() -> fading.setOpacity(0.5));
+        Thread.sleep(500);
+
+        // 3. Capture what the X server shows
+        int[] pixels = new int[WIDTH * HEIGHT];
+        runAndWait(() -> {
+            WritableImage image = new Robot().getScreenCapture(null, X, Y, WIDTH, HEIGHT);
+            PixelReader reader = image.getPixelReader();
+            for (int y = 0; y < HEIGHT; y++) {
+                for (int x = 0; x < WIDTH; x++) {
+                    pixels[y * WIDTH + x] = reader.getArgb(x, y);
+                }
+            }
+        });
+
+        try (DataOutputStream out = new DataOutputStream(
+                new BufferedOutputStream(new FileOutputStream(output)))) {
+            for (int pixel : pixels) {
+                out.writeInt(pixel);
+            }
+        } catch (IOException e) {
+            e.printStackTrace();
+            System.exit(ERROR_CAPTURE);
+        }
+
+        System.exit(ERROR_NONE);
+    }
+
+    private static void runAndWait(Runnable r) {
+        CountDownLatch latch = new CountDownLatch(1);
+        Platform.runLater(() -> {
+            try {
+                r.run();
+            } finally {
+                latch.countDown();
+            }
+        });
+        waitForLatch(latch, 5, ERROR_CAPTURE);
+    }
+
+    private static void waitForLatch(CountDownLatch latch, int seconds, int error) {
+        try {
+            if (!latch.await(seconds, TimeUnit.SECONDS)) {
+                System.exit(error);
+            }
+        } catch (Exception ex) {
+            System.exit(error);
+        }
+    }
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.robot.com.sun.glass.ui.gtk;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assertions.fail;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import static test.robot.com.sun.glass.ui.gtk.ShmPresenterApp.ERROR_CAPTURE;
+import static test.robot.com.sun.glass.ui.gtk.ShmPresenterApp.ERROR_LAUNCH;
+import static test.robot.com.sun.glass.ui.gtk.ShmPresenterApp.ERROR_NONE;
+import static test.robot.com.sun.glass.ui.gtk.ShmPresenterApp.HEIGHT;
+import static test.robot.com.sun.glass.ui.gtk.ShmPresenterApp.WIDTH;
+import java.io.BufferedInputStream;
+import java.io.DataInputStream;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import com.sun.javafx.PlatformUtil;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.Timeout;
+import test.util.Util;
+
+/**
+ * Verifies that the GTK glass window presents the same pixels through the
+ * MIT-SHM images as through the cairo fallback. The path is chosen once per
+ * process, so each one runs in its own software rendered application.
+ */
+public class ShmPresenterTest {
+
+    private static final String SHM_USED = "Glass GTK: presenting through MIT-SHM";
+    private static final String CAIRO_USED = "Glass GTK: presenting through cairo";
+    private static final String SHM_FAILED = "Glass GTK: MIT-SHM failed";
+
+    private final String testAppName = ShmPresenterApp.class.getName();
+
+    private Path dir;
+
+    @BeforeEach
+    public void setUp() throws IOException {
+        assumeTrue(PlatformUtil.isLinux());
+        dir = Files.createTempDirectory("shm-presenter-test");
+    }
+
+    @AfterEach
+    public void tearDown() throws IOException {
+        if (dir != null) {
+            Files.deleteIfExists(dir.resolve("shm.bin"));
+            Files.deleteIfExists(dir.resolve("cairo.bin"));
+            Files.deleteIfExists(dir);
+        }
+    }
+
+    @Test
+    @Timeout(value=60)
+    public void testShmMatchesCairo() throws Exception {
+        Path shmFile = dir.resolve("shm.bin");
+        String shmOutput = launch(false, shmFile);
+        // Xvfb and local servers provide MIT-SHM, a remote display does not
+        assumeTrue(shmOutput.contains(SHM_USED), "MIT-SHM not available");
+        assertFalse(shmOutput.contains(SHM_FAILED), "Fell back to cairo while presenting");
+
+        Path cairoFile = dir.resolve("cairo.bin");
+        String cairoOutput = launch(true, cairoFile);
+        assertTrue(cairoOutput.contains(CAIRO_USED), "glass.disableShm did not select cairo");
+        assertFalse(cairoOutput.contains(SHM_USED), "glass.disableShm did not disable MIT-SHM");
+
+        int[] shm = readPixels(shmFile);
+        int[] cairo = readPixels(cairoFile);
+        int mismatches = 0;
+        String first = null;
+        for (int i = 0; i < shm.length; i++) {
+            if (shm[i] != cairo[i]) {
+                if (first == null) {
+                    first = String.format("(%d, %d): shm 0x%08x, cairo 0x%08x",
+                            i % WIDTH, i / WIDTH, shm[i], cairo[i]);
+                }
+                mismatches++;
+            }
+        }
+        assertEquals(0, mismatches, "Pixels differ, first at " + first);
+    }
+
+    /**
+     * Runs the application and returns its output with verbose GTK
+     * logging, which names the present path.
+     */
+    private String launch(boolean disableShm, Path output) throws Exception {
+        String[] jvmArgs = {
+            "-Dprism.order=sw",
+            "-Djdk.gtk.verbose=true",
+            "-Dglass.disableShm=" + disableShm,
+        };
+        final ArrayList<String> cmd = Util.createApplicationLaunchCommand(
+                testAppName, null, jvmArgs);
+        cmd.add(output.toString());
+        ProcessBuilder builder = new ProcessBuilder(cmd);
+        builder.redirectErrorStream(true);
+        Process process = builder.start();
+
+        String text = new String(process.getInputStream().readAllBytes(), StandardCharsets.UTF_8);
+        System.err.print(text);
+
+        int retVal = process.waitFor();
+        switch (retVal) {
+            case 0:
+                fail(testAppName + ": Unexpected exit 0");
+                break;
+
+            case 1:
+                fail(testAppName + ": Unable to launch java application");
+                break;
+
+            case ERROR_NONE:
+                break;
+
+            case ERROR_LAUNCH:
+                fail(testAppName + ": Window was not shown for more than 10 secs");
+                break;
+
+            case ERROR_CAPTURE:
+                fail(testAppName + ": Unable to capture the window");
+                break;
+
+            default:
+                fail(testAppName + ": Unexpected error exit: " + retVal);
+                break;
+        }
+        return text;
+    }
+
+    private static int[] readPixels(Path file) throws IOException {
+        assertEquals((long) WIDTH * HEIGHT * 4, Files.size(file));
+        int[] pixels = new int[WIDTH * HEIGHT];
+        try (DataInputStream in = new DataInputStream(
+                new BufferedInputStream(new FileInputStream(file.toFile())))) {
+            for (int i = 0; i < pixels.length; i++) {
+                pixels[i] = in.readInt();
+            }
+        }
+        return pixels;
+    }
+}